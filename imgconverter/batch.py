@@ -0,0 +1,155 @@
+import argparse
+import hashlib
+import itertools
+import os
+import time
+from multiprocessing import Pool
+import cv2 as cv
+import numpy as np
+import quantize
+
+REFRESH = 60  # frames per second of the VGA output
+IMAGE_EXTS = ('.png', '.jpg', '.jpeg', '.bmp')
+CHUNK = 256  # source frames read and converted at a time, so a long clip is never all in memory
+
+
+# yield (image, duration in seconds) for every frame of a video, GIF or directory of images
+def readFrames(path: str, fps: float):
+    if os.path.isdir(path):
+        for name in sorted(os.listdir(path)):
+            if name.lower().endswith(IMAGE_EXTS):
+                img = cv.imread(os.path.join(path, name))
+                if img is None:
+                    raise IOError('could not read {}'.format(os.path.join(path, name)))
+                yield img, 1 / fps
+        return
+
+    cap = cv.VideoCapture(path)
+    if not cap.isOpened():
+        raise IOError('could not open {}'.format(path))
+    srcFps = cap.get(cv.CAP_PROP_FPS)
+    if not srcFps or srcFps != srcFps:  # some containers (and most GIFs) don't report a rate
+        srcFps = fps
+    while True:
+        ok, img = cap.read()
+        if not ok:
+            break
+        yield img, 1 / srcFps
+    cap.release()
+
+
+# the cache key covers everything that affects the converted frame, so changing the settings invalidates it
+def frameKey(img: np.ndarray, size, method: str, palette: str):
+    h = hashlib.sha1()
+    h.update('{}x{} {} {} {}'.format(size[0], size[1], method, palette, img.shape).encode())
+    h.update(img.tobytes())
+    return h.hexdigest()
+
+
+def convertFrame(job):
+    img, size, method, palette, cacheDir = job
+    key = frameKey(img, size, method, palette)
+    cached = os.path.join(cacheDir, key + '.bin')
+    if os.path.exists(cached):
+        with open(cached, 'rb') as f:
+            return f.read(), True
+
+    small = cv.resize(img, size, interpolation=cv.INTER_AREA)
+    data = quantize.quantize(quantize.genColorMap(palette), small, method, quantize.paletteStep(palette)).tobytes()
+    tmp = cached + '.{}'.format(os.getpid())
+    with open(tmp, 'wb') as f:
+        f.write(data)
+    os.replace(tmp, cached)  # so a half-written file never looks like a cache hit
+    return data, False
+
+
+# convert every frame of a clip on the pool, CHUNK source frames at a time.
+# yields (data, cache hit, duration in seconds) for each, in order
+def convertClip(pool, path: str, fps: float, size, method: str, palette: str, cacheDir: str):
+    sources = readFrames(path, fps)
+    while True:
+        chunk = list(itertools.islice(sources, CHUNK))
+        if not chunk:
+            return
+        jobs = [(img, size, method, palette, cacheDir) for img, _ in chunk]
+        for (data, hit), (_, duration) in zip(pool.imap(convertFrame, jobs, chunksize=8), chunk):
+            yield data, hit, duration
+
+
+# turn per-frame durations into whole refreshes without letting the rounding error build up over the clip.
+# A frame that ends before the next refresh gets 0 and is never shown (see collapse), so a source faster than the
+# refresh rate has frames dropped instead of running slow
+def toTicks(durations):
+    ticks = []
+    elapsed = 0.0
+    shown = 0
+    for d in durations:
+        elapsed += d
+        end = round(elapsed * REFRESH)
+        ticks.append(end - shown)
+        shown = end
+    if ticks and not shown:  # shorter than half a refresh, but the last frame is still shown once
+        ticks[-1] = 1
+    return ticks
+
+
+# merge runs of identical frames into one longer frame, and leave out the ones with no refreshes of their own
+def collapse(frames, ticks):
+    outFrames, outTicks = [], []
+    for data, t in zip(frames, ticks):
+        if not t:
+            continue
+        if outFrames and outFrames[-1] == data:
+            outTicks[-1] += t
+        else:
+            outFrames.append(data)
+            outTicks.append(t)
+    return outFrames, outTicks
+
+
+def writeAnimation(name: str, size, frames, ticks):
+    with open(name + '.c', 'w') as outf:
+        outf.write('// {} frames of {}x{}\n'.format(len(frames), size[0], size[1]))
+        outf.write('const char {}[{}][{}] = {{\n'.format(name, len(frames), size[0] * size[1]))
+        for i, data in enumerate(frames):
+            rows = [', '.join(str(v) for v in data[y * size[0]:(y + 1) * size[0]]) for y in range(size[1])]
+            outf.write('{\n' + ', \n'.join(rows) + '\n}')
+            outf.write(',\n' if i != len(frames) - 1 else '\n')
+        outf.write('};\n')
+        outf.write('// how many refreshes each frame stays on screen\n')
+        outf.write('const unsigned short {}Ticks[{}] = {{{}}};\n'.format(name, len(ticks), ', '.join(map(str, ticks))))
+        outf.write('const int {}Frames = {};\n'.format(name, len(frames)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a video, GIF or directory of images into an animation')
+    parser.add_argument('input')
+    parser.add_argument('--name', help='C symbol and output file name (defaults to the input name)')
+    parser.add_argument('--size', default='80x60', help='frame geometry, WIDTHxHEIGHT')
+    parser.add_argument('--fps', type=float, default=REFRESH,
+                        help='frame rate for image directories and inputs that don\'t report one')
+    parser.add_argument('--quantize', choices=['nearest', 'floyd', 'ordered'], default='nearest')
+    parser.add_argument('--palette', choices=sorted(quantize.PALETTES), default='bgr222')
+    parser.add_argument('--cache', default='.cache', help='directory for converted frames')
+    parser.add_argument('--jobs', type=int, default=os.cpu_count())
+    args = parser.parse_args()
+
+    size = tuple(int(v) for v in args.size.lower().split('x'))
+    name = args.name or os.path.splitext(os.path.basename(os.path.normpath(args.input)))[0]
+    os.makedirs(args.cache, exist_ok=True)
+
+    start = time.perf_counter()
+    with Pool(args.jobs) as pool:
+        results = list(convertClip(pool, args.input, args.fps, size, args.quantize, args.palette, args.cache))
+
+    frames, ticks = collapse([data for data, _, _ in results], toTicks([d for _, _, d in results]))
+    writeAnimation(name, size, frames, ticks)
+
+    hits = sum(1 for _, hit, _ in results if hit)
+    print('{} source frames ({} cached) -> {} frames, {} bytes, {:.2f} s of animation, in {:.3f} s'.format(
+        len(results), hits, len(frames), len(frames) * size[0] * size[1], sum(ticks) / REFRESH,
+        time.perf_counter() - start))
+
+
+if __name__ == '__main__':
+    main()
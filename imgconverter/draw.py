@@ -0,0 +1,53 @@
+import argparse
+import serial
+from upload import send
+
+# the arguments each command takes, see inc/draw.h
+COMMANDS = {'clear': 1, 'rect': 5, 'text': 4, 'blit': 3, 'status': 0}
+
+
+def encode(name: str, args: list):
+    if name == 'clear':
+        return 'X', bytes([int(args[0])])
+    if name == 'rect':
+        return 'R', bytes(int(a) for a in args)
+    if name == 'text':
+        return 'T', bytes(int(a) for a in args[:3]) + args[3].encode('ascii')[:61]
+    if name == 'blit':
+        return 'B', int(args[0]).to_bytes(2, 'little') + bytes([int(args[1]), int(args[2])])
+    return 'Q', b''
+
+
+# send drawing commands to a running board, e.g. clear 0 rect 10 10 20 8 48 text 12 11 63 "HI" status
+def main():
+    parser = argparse.ArgumentParser(description='Draw on a running board over the UART')
+    parser.add_argument('port')
+    parser.add_argument('commands', nargs='+', help='clear color | rect x y w h color | text x y color string | '
+                                                    'blit asset x y | status')
+    parser.add_argument('--baud', type=int, default=115200)
+    args = parser.parse_args()
+
+    packets = []
+    words = args.commands
+    while words:
+        name = words.pop(0)
+        if name not in COMMANDS or len(words) < COMMANDS[name]:
+            parser.error('bad command {}'.format(name))
+        packets.append(encode(name, words[:COMMANDS[name]]))
+        del words[:COMMANDS[name]]
+
+    # the board stops us with XOFF while its queue is full, which the serial driver handles
+    with serial.Serial(args.port, args.baud, timeout=1, xonxoff=True) as port:
+        for cmd, payload in packets:
+            send(port, cmd, payload)
+            if cmd == 'Q':
+                queued, frame, total, late, dropped = port.readline().decode().lstrip('N').split()
+                print('{} bytes queued, {} commands last frame, {} in total, {} late frames, {} dropped'.format(
+                    queued, frame, total, late, dropped))
+        refused = port.read(port.in_waiting).count(b'N')
+        if refused:
+            print('{} commands refused'.format(refused))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,126 @@
+const char lennaDither[2][60][81] = {
+{
+{22, 43, 22, 43, 22, 43, 22, 43, 22, 23, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 27, 22, 43, 22, 43, 22, 27, 22, 27, 22, 43, 22, 43, 43, 47, 22, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 22, 0},
+{43, 22, 43, 22, 27, 22, 43, 23, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 22, 22, 43, 22, 43, 22, 43, 22, 27, 22, 27, 22, 43, 22, 47, 43, 43, 22, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 22, 17, 0},
+{22, 43, 22, 43, 22, 43, 22, 43, 22, 23, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 27, 26, 47, 43, 43, 22, 22, 22, 22, 22, 23, 22, 23, 22, 21, 17, 21, 0},
+{43, 22, 43, 22, 43, 22, 43, 22, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 39, 22, 43, 22, 43, 22, 27, 22, 43, 22, 43, 22, 27, 27, 47, 43, 27, 22, 22, 22, 22, 22, 23, 17, 21, 1, 21, 1, 0},
+{22, 43, 22, 43, 22, 27, 22, 43, 22, 23, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 27, 27, 47, 43, 22, 22, 22, 22, 22, 17, 17, 17, 21, 1, 21, 0},
+{43, 22, 43, 22, 27, 22, 43, 22, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 22, 43, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 23, 22, 43, 22, 43, 22, 43, 22, 27, 22, 27, 22, 27, 22, 43, 43, 47, 26, 22, 22, 22, 1, 17, 17, 21, 17, 17, 1, 0},
+{22, 43, 22, 27, 22, 27, 22, 43, 22, 23, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 26, 43, 42, 43, 42, 43, 42, 43, 22, 23, 22, 23, 22, 23, 22, 22, 22, 22, 22, 43, 22, 43, 22, 43, 22, 27, 22, 27, 22, 27, 22, 27, 22, 43, 43, 47, 26, 22, 1, 17, 17, 21, 17, 21, 1, 17, 0},
+{43, 23, 27, 22, 23, 22, 43, 23, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 39, 22, 22, 22, 38, 22, 43, 22, 43, 26, 43, 42, 43, 42, 43, 42, 43, 22, 22, 22, 23, 22, 23, 22, 22, 22, 23, 22, 43, 22, 43, 22, 43, 22, 27, 22, 27, 22, 27, 22, 27, 22, 43, 43, 43, 1, 17, 17, 21, 1, 21, 1, 21, 1, 0},
+{23, 27, 22, 22, 22, 27, 23, 43, 22, 23, 17, 22, 22, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 22, 22, 22, 22, 39, 22, 43, 22, 43, 22, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 38, 22, 22, 22, 22, 22, 22, 22, 43, 22, 43, 22, 23, 22, 27, 22, 27, 22, 27, 22, 27, 22, 27, 22, 22, 17, 17, 1, 21, 1, 21, 17, 21, 17, 21, 0},
+{27, 22, 22, 18, 23, 22, 43, 23, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 22, 22, 22, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 42, 43, 42, 43, 42, 47, 42, 63, 43, 43, 18, 22, 22, 22, 22, 23, 22, 43, 22, 23, 22, 22, 22, 27, 22, 27, 22, 27, 22, 27, 22, 22, 1, 17, 1, 21, 1, 21, 17, 21, 17, 22, 22, 0},
+{22, 22, 18, 22, 22, 27, 23, 43, 22, 23, 18, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 22, 22, 22, 22, 22, 22, 23, 22, 43, 22, 43, 22, 43, 26, 43, 42, 43, 42, 47, 42, 47, 42, 63, 43, 43, 18, 22, 18, 22, 22, 43, 22, 43, 22, 22, 17, 23, 22, 27, 22, 27, 22, 27, 22, 22, 17, 17, 17, 21, 1, 21, 17, 21, 17, 22, 22, 43, 0},
+{22, 18, 22, 18, 23, 22, 43, 23, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 22, 22, 22, 22, 22, 22, 23, 22, 43, 22, 43, 22, 43, 22, 43, 42, 43, 42, 47, 42, 43, 42, 47, 42, 63, 42, 43, 22, 22, 18, 23, 22, 43, 22, 27, 18, 17, 17, 23, 22, 27, 22, 27, 22, 22, 1, 17, 17, 21, 1, 21, 17, 21, 17, 38, 22, 43, 22, 0},
+{18, 22, 18, 22, 22, 43, 22, 43, 22, 23, 18, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 22, 22, 22, 22, 22, 22, 23, 22, 43, 22, 43, 22, 23, 22, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 47, 42, 47, 42, 63, 22, 22, 22, 43, 22, 43, 22, 22, 1, 17, 18, 23, 22, 27, 22, 23, 1, 17, 1, 21, 17, 21, 17, 21, 17, 38, 22, 43, 22, 43, 0},
+{22, 18, 22, 18, 23, 22, 43, 22, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 23, 22, 39, 22, 43, 22, 38, 22, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 47, 42, 63, 42, 47, 17, 23, 22, 43, 22, 27, 18, 17, 1, 22, 42, 47, 42, 43, 17, 21, 17, 21, 17, 21, 17, 21, 17, 38, 22, 43, 22, 43, 22, 0},
+{18, 22, 18, 22, 22, 27, 23, 43, 22, 23, 17, 22, 18, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 43, 26, 43, 26, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 63, 42, 43, 22, 43, 22, 43, 22, 22, 17, 42, 42, 47, 42, 63, 43, 38, 17, 21, 17, 21, 1, 21, 17, 38, 22, 43, 22, 43, 22, 43, 0},
+{22, 22, 22, 18, 23, 22, 43, 23, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 22, 27, 23, 22, 22, 22, 23, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 43, 22, 27, 22, 23, 22, 43, 42, 47, 42, 47, 42, 63, 21, 21, 17, 17, 1, 21, 1, 22, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 27, 23, 43, 22, 23, 18, 22, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 26, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 22, 43, 42, 43, 42, 47, 42, 47, 42, 63, 43, 22, 17, 21, 1, 17, 17, 22, 22, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 22, 22, 22, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 22, 22, 22, 22, 27, 27, 22, 22, 22, 22, 22, 23, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 26, 43, 26, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 47, 42, 43, 42, 43, 17, 17, 17, 17, 17, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 27, 27, 43, 23, 23, 18, 22, 22, 22, 22, 22, 22, 22, 22, 43, 22, 23, 22, 22, 22, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 26, 43, 22, 43, 22, 43, 22, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 43, 22, 43, 21, 21, 17, 17, 1, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 18, 22, 22, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 22, 22, 18, 43, 27, 27, 22, 23, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 43, 22, 43, 42, 21, 17, 21, 17, 21, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 27, 27, 43, 23, 23, 18, 22, 22, 22, 22, 22, 22, 22, 22, 43, 27, 27, 22, 23, 22, 23, 22, 43, 22, 23, 22, 43, 22, 43, 22, 38, 22, 38, 22, 38, 22, 42, 22, 38, 21, 38, 22, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 43, 22, 22, 42, 22, 1, 21, 1, 21, 17, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 22, 22, 22, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 22, 22, 18, 22, 27, 43, 22, 23, 22, 22, 22, 39, 22, 23, 22, 39, 22, 38, 22, 38, 22, 22, 21, 38, 17, 38, 17, 21, 17, 22, 22, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 43, 22, 22, 22, 38, 26, 38, 1, 21, 1, 21, 17, 38, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 27, 27, 43, 23, 23, 17, 22, 18, 22, 22, 22, 22, 22, 18, 43, 27, 27, 22, 22, 22, 23, 22, 23, 22, 39, 22, 38, 22, 22, 17, 22, 17, 38, 17, 38, 17, 21, 17, 38, 22, 43, 42, 43, 42, 43, 42, 43, 42, 43, 22, 42, 22, 22, 22, 43, 26, 22, 1, 21, 1, 21, 17, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 22, 22, 22, 23, 22, 43, 27, 43, 22, 22, 18, 22, 18, 22, 18, 22, 22, 22, 22, 47, 26, 27, 22, 23, 22, 23, 22, 23, 22, 22, 17, 22, 17, 22, 17, 22, 17, 22, 21, 37, 17, 42, 26, 43, 42, 43, 42, 43, 42, 43, 42, 42, 17, 38, 22, 43, 22, 43, 22, 21, 1, 21, 17, 17, 1, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 43, 27, 43, 23, 23, 17, 22, 18, 22, 18, 22, 22, 22, 22, 22, 26, 43, 22, 23, 22, 39, 22, 38, 22, 22, 17, 22, 17, 21, 17, 21, 17, 21, 17, 22, 21, 38, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 22, 22, 21, 38, 22, 43, 17, 17, 1, 21, 17, 17, 1, 21, 22, 38, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 22, 22, 18, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 22, 22, 22, 22, 22, 43, 27, 23, 22, 22, 22, 23, 22, 22, 17, 21, 17, 22, 17, 22, 17, 21, 1, 21, 22, 42, 42, 43, 42, 43, 42, 43, 42, 43, 43, 43, 43, 43, 22, 21, 17, 42, 22, 17, 1, 21, 17, 21, 1, 21, 17, 42, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 43, 27, 43, 23, 23, 18, 22, 18, 22, 22, 22, 22, 23, 22, 23, 22, 43, 22, 22, 22, 23, 18, 22, 17, 21, 17, 21, 17, 22, 17, 38, 1, 22, 22, 43, 22, 43, 42, 43, 26, 43, 22, 43, 43, 43, 43, 47, 43, 43, 1, 21, 22, 38, 17, 21, 17, 22, 1, 21, 17, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 22, 22, 18, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 39, 18, 21, 17, 21, 17, 21, 17, 21, 17, 22, 17, 22, 22, 43, 42, 43, 42, 43, 22, 43, 22, 43, 43, 43, 43, 43, 43, 47, 22, 22, 1, 22, 22, 21, 17, 22, 17, 21, 1, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 43, 27, 43, 23, 23, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 22, 22, 38, 22, 22, 17, 22, 17, 22, 17, 21, 17, 22, 17, 22, 22, 43, 22, 43, 42, 43, 22, 43, 22, 43, 27, 43, 43, 43, 43, 43, 43, 43, 18, 17, 17, 42, 17, 21, 17, 21, 17, 21, 22, 42, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 42, 22, 43, 0},
+{22, 22, 22, 18, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 22, 17, 38, 17, 22, 17, 22, 17, 21, 17, 21, 1, 22, 17, 22, 22, 43, 42, 43, 26, 23, 22, 23, 22, 22, 22, 43, 22, 43, 43, 43, 22, 22, 22, 22, 1, 21, 22, 22, 17, 22, 17, 21, 17, 42, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 0},
+{22, 22, 18, 22, 22, 43, 27, 43, 23, 23, 18, 22, 18, 22, 18, 22, 22, 43, 22, 43, 22, 22, 17, 22, 17, 38, 17, 21, 17, 17, 17, 21, 1, 21, 22, 43, 42, 43, 22, 22, 1, 22, 17, 22, 18, 23, 22, 43, 43, 43, 22, 22, 17, 22, 1, 17, 17, 42, 17, 22, 1, 21, 17, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 42, 0},
+{22, 22, 22, 17, 22, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 18, 22, 22, 43, 22, 22, 17, 21, 17, 22, 21, 21, 17, 21, 17, 17, 1, 21, 22, 43, 42, 43, 22, 22, 17, 22, 17, 42, 42, 22, 22, 23, 22, 43, 22, 22, 17, 42, 17, 17, 1, 21, 22, 22, 17, 21, 1, 21, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 42, 22, 0},
+{22, 22, 18, 22, 22, 43, 27, 43, 27, 23, 18, 22, 22, 23, 17, 38, 22, 42, 21, 21, 21, 38, 17, 38, 17, 38, 21, 17, 1, 21, 1, 17, 22, 43, 42, 43, 22, 39, 22, 39, 22, 39, 22, 43, 22, 23, 22, 43, 43, 43, 22, 39, 22, 22, 1, 21, 17, 42, 22, 22, 1, 21, 17, 42, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 43, 26, 43, 0},
+{22, 18, 22, 1, 22, 22, 43, 27, 43, 22, 22, 18, 22, 22, 39, 22, 38, 17, 21, 17, 38, 17, 21, 17, 38, 21, 38, 17, 17, 17, 21, 17, 43, 42, 43, 22, 23, 22, 43, 22, 43, 22, 43, 22, 43, 22, 23, 22, 43, 42, 43, 22, 23, 22, 22, 1, 22, 22, 38, 17, 21, 1, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 26, 43, 27, 43, 26, 0},
+{18, 22, 17, 22, 22, 43, 27, 43, 27, 27, 18, 22, 22, 39, 22, 38, 17, 21, 17, 38, 21, 21, 17, 21, 17, 22, 21, 22, 1, 17, 17, 38, 42, 42, 17, 23, 22, 43, 22, 43, 27, 43, 26, 43, 22, 43, 22, 23, 43, 43, 22, 43, 22, 23, 17, 21, 17, 38, 22, 17, 1, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 26, 43, 27, 43, 26, 43, 0},
+{22, 17, 22, 1, 22, 22, 43, 27, 43, 22, 22, 22, 22, 22, 38, 21, 38, 17, 21, 21, 22, 17, 21, 17, 21, 1, 22, 22, 22, 1, 22, 26, 42, 17, 22, 22, 23, 22, 43, 22, 43, 27, 43, 22, 43, 22, 23, 22, 43, 43, 43, 22, 39, 22, 22, 1, 22, 21, 42, 1, 21, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 26, 43, 27, 43, 27, 47, 43, 0},
+{17, 22, 17, 22, 18, 43, 27, 43, 27, 27, 18, 22, 22, 38, 17, 38, 17, 38, 21, 38, 17, 21, 17, 17, 17, 22, 22, 22, 17, 22, 22, 43, 1, 21, 17, 23, 22, 23, 22, 43, 22, 43, 22, 43, 22, 23, 22, 23, 22, 63, 22, 43, 22, 22, 17, 22, 17, 22, 22, 21, 17, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 26, 43, 27, 43, 43, 47, 43, 47, 0},
+{22, 17, 22, 1, 22, 22, 43, 27, 43, 22, 22, 22, 22, 22, 22, 21, 22, 21, 37, 21, 38, 17, 21, 1, 22, 21, 22, 1, 22, 22, 43, 17, 17, 17, 22, 22, 23, 22, 39, 22, 43, 22, 43, 22, 23, 22, 23, 22, 43, 43, 43, 22, 23, 17, 21, 17, 22, 17, 43, 17, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 43, 27, 43, 43, 47, 43, 47, 43, 0},
+{17, 22, 17, 22, 22, 43, 22, 43, 27, 27, 18, 22, 22, 22, 17, 22, 17, 38, 17, 38, 37, 22, 17, 22, 17, 22, 17, 22, 22, 43, 17, 21, 1, 22, 18, 23, 22, 23, 22, 43, 22, 43, 22, 43, 22, 23, 22, 23, 22, 43, 22, 39, 22, 21, 17, 22, 1, 21, 22, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 27, 43, 43, 47, 43, 47, 43, 47, 0},
+{22, 17, 22, 17, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 21, 21, 17, 38, 21, 38, 21, 22, 17, 21, 22, 43, 22, 38, 17, 21, 17, 21, 17, 22, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 22, 43, 42, 43, 26, 43, 22, 21, 17, 21, 17, 22, 1, 38, 22, 27, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 26, 43, 27, 47, 43, 47, 43, 47, 43, 0},
+{17, 22, 17, 22, 22, 43, 23, 43, 27, 27, 18, 22, 22, 22, 17, 22, 17, 21, 21, 38, 17, 38, 21, 22, 22, 43, 22, 22, 17, 22, 1, 22, 17, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 22, 22, 17, 21, 17, 22, 17, 17, 22, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 43, 27, 47, 43, 47, 43, 47, 43, 47, 0},
+{22, 1, 22, 17, 22, 22, 43, 27, 43, 22, 22, 18, 38, 21, 22, 17, 21, 17, 38, 21, 38, 21, 38, 22, 43, 22, 22, 21, 21, 1, 21, 1, 22, 17, 22, 18, 23, 22, 23, 22, 43, 22, 23, 22, 23, 22, 43, 22, 39, 22, 22, 17, 21, 1, 22, 17, 22, 17, 22, 22, 27, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 27, 47, 43, 47, 43, 47, 43, 47, 43, 0},
+{1, 22, 1, 22, 22, 43, 27, 43, 27, 43, 18, 22, 22, 22, 21, 21, 17, 38, 37, 38, 21, 38, 22, 39, 22, 43, 21, 21, 17, 21, 17, 22, 17, 22, 17, 22, 22, 23, 22, 23, 22, 43, 22, 23, 22, 23, 22, 39, 22, 23, 17, 21, 17, 21, 17, 22, 17, 22, 17, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 42, 22, 47, 43, 47, 43, 47, 43, 47, 43, 47, 0},
+{21, 1, 22, 22, 23, 22, 43, 27, 43, 22, 22, 22, 22, 17, 22, 17, 21, 21, 38, 37, 38, 21, 38, 22, 43, 17, 21, 17, 21, 17, 21, 17, 22, 1, 22, 17, 22, 18, 23, 22, 23, 22, 39, 22, 43, 22, 43, 22, 43, 17, 21, 17, 21, 1, 22, 17, 22, 17, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 42, 43, 47, 43, 47, 43, 47, 43, 47, 43, 0},
+{1, 21, 17, 22, 22, 43, 27, 43, 27, 27, 18, 22, 17, 22, 17, 21, 17, 38, 21, 38, 37, 38, 38, 38, 21, 21, 17, 21, 17, 21, 17, 21, 1, 22, 17, 22, 17, 22, 2, 22, 22, 39, 22, 43, 22, 43, 22, 43, 22, 21, 17, 21, 17, 21, 17, 22, 17, 22, 17, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 42, 22, 47, 43, 47, 43, 47, 43, 47, 27, 43, 0},
+{21, 1, 17, 17, 22, 22, 43, 27, 43, 22, 38, 22, 22, 17, 21, 17, 21, 17, 42, 17, 38, 21, 38, 38, 38, 17, 21, 17, 22, 17, 21, 17, 21, 17, 22, 17, 22, 17, 22, 22, 22, 22, 39, 22, 43, 22, 43, 22, 42, 17, 21, 17, 21, 17, 22, 21, 22, 17, 22, 22, 22, 22, 38, 22, 42, 22, 42, 22, 42, 22, 43, 43, 47, 43, 47, 27, 43, 22, 21, 1, 0},
+{21, 22, 17, 22, 18, 27, 22, 43, 27, 43, 22, 22, 17, 21, 17, 21, 17, 21, 21, 38, 21, 38, 21, 38, 21, 42, 21, 21, 17, 21, 17, 21, 17, 21, 17, 22, 1, 22, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 42, 43, 42, 42, 17, 17, 17, 22, 17, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 26, 47, 43, 47, 27, 43, 17, 22, 17, 22, 0},
+{42, 22, 22, 17, 22, 22, 43, 23, 43, 22, 38, 17, 17, 17, 38, 17, 38, 17, 22, 21, 38, 17, 38, 37, 42, 21, 38, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 23, 22, 23, 22, 43, 22, 43, 22, 43, 26, 43, 42, 43, 43, 43, 22, 22, 17, 22, 17, 22, 22, 43, 22, 42, 22, 38, 22, 22, 22, 22, 22, 43, 43, 47, 27, 22, 17, 22, 17, 22, 18, 0},
+{22, 42, 22, 22, 17, 27, 27, 43, 27, 43, 22, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 21, 38, 38, 38, 22, 38, 17, 21, 17, 21, 17, 21, 17, 22, 17, 22, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 26, 43, 43, 43, 43, 47, 42, 22, 17, 22, 22, 43, 22, 43, 22, 42, 22, 42, 22, 22, 22, 27, 43, 47, 27, 27, 17, 22, 18, 22, 22, 22, 0},
+{21, 22, 42, 22, 22, 22, 43, 27, 43, 22, 38, 17, 21, 17, 21, 17, 38, 17, 21, 17, 22, 17, 38, 21, 38, 38, 21, 38, 21, 17, 22, 1, 21, 17, 22, 22, 22, 17, 23, 22, 23, 22, 27, 22, 43, 22, 43, 22, 43, 26, 43, 43, 47, 43, 47, 22, 17, 1, 22, 22, 43, 22, 42, 22, 42, 22, 42, 22, 27, 26, 47, 43, 43, 22, 22, 22, 22, 22, 22, 22, 0},
+{1, 38, 42, 42, 1, 27, 27, 43, 27, 27, 22, 21, 17, 21, 17, 21, 21, 21, 17, 21, 17, 22, 21, 38, 38, 42, 17, 42, 17, 22, 17, 21, 17, 21, 17, 22, 18, 22, 22, 23, 22, 23, 22, 27, 22, 43, 22, 43, 26, 43, 26, 43, 43, 47, 43, 63, 17, 17, 22, 43, 22, 43, 22, 42, 22, 42, 22, 43, 27, 47, 43, 47, 22, 22, 22, 22, 22, 22, 22, 22, 0},
+{17, 21, 42, 22, 17, 22, 43, 27, 43, 22, 22, 17, 17, 17, 21, 17, 22, 17, 21, 17, 21, 17, 22, 21, 42, 21, 42, 22, 22, 17, 22, 17, 21, 17, 22, 22, 22, 18, 23, 22, 23, 22, 23, 22, 27, 22, 43, 22, 43, 26, 43, 42, 43, 43, 47, 43, 43, 1, 27, 22, 43, 22, 42, 22, 42, 22, 22, 27, 47, 43, 47, 26, 22, 22, 22, 22, 22, 22, 22, 21, 0},
+{1, 22, 42, 42, 1, 23, 27, 43, 27, 43, 22, 21, 1, 21, 17, 21, 17, 21, 17, 21, 17, 22, 17, 38, 37, 38, 17, 21, 17, 22, 17, 22, 1, 22, 22, 23, 18, 22, 22, 23, 22, 23, 22, 23, 22, 27, 22, 43, 22, 43, 26, 43, 42, 47, 43, 47, 43, 22, 22, 43, 22, 42, 22, 42, 22, 42, 22, 43, 27, 47, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 0},
+{17, 17, 42, 22, 22, 22, 43, 27, 43, 22, 22, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 38, 21, 38, 17, 38, 21, 21, 1, 21, 1, 22, 22, 23, 22, 22, 22, 23, 22, 27, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 26, 43, 43, 47, 43, 47, 22, 22, 22, 42, 22, 42, 22, 42, 22, 27, 22, 43, 43, 43, 22, 22, 22, 22, 18, 22, 21, 22, 17, 0},
+{1, 21, 38, 42, 17, 23, 22, 43, 27, 27, 22, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 21, 38, 17, 22, 17, 21, 1, 21, 1, 21, 18, 23, 22, 22, 22, 23, 22, 27, 22, 27, 22, 23, 22, 27, 22, 43, 22, 43, 22, 43, 42, 43, 43, 47, 43, 43, 17, 22, 17, 22, 22, 22, 22, 43, 22, 27, 27, 47, 22, 22, 18, 22, 18, 22, 22, 22, 21, 22, 0},
+{22, 17, 42, 42, 22, 22, 43, 26, 43, 22, 22, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 37, 38, 21, 21, 1, 17, 1, 17, 17, 22, 22, 22, 17, 23, 22, 23, 22, 23, 22, 27, 22, 23, 22, 27, 22, 43, 22, 43, 26, 43, 42, 47, 43, 47, 43, 22, 22, 22, 17, 22, 1, 21, 22, 43, 26, 47, 26, 22, 17, 22, 18, 22, 17, 22, 22, 22, 1, 0},
+{21, 22, 22, 43, 22, 23, 22, 43, 27, 27, 22, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 22, 21, 38, 17, 21, 1, 17, 1, 22, 22, 22, 17, 23, 22, 23, 22, 23, 22, 27, 22, 27, 22, 23, 22, 27, 22, 43, 22, 43, 26, 43, 42, 47, 43, 47, 26, 22, 22, 22, 21, 22, 17, 22, 27, 43, 22, 22, 17, 22, 17, 22, 17, 22, 22, 22, 17, 22, 0},
+{22, 21, 42, 42, 38, 22, 43, 27, 43, 22, 22, 17, 21, 17, 21, 17, 21, 17, 22, 17, 21, 17, 22, 17, 38, 17, 21, 1, 17, 1, 22, 17, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 27, 22, 27, 22, 27, 22, 27, 22, 43, 22, 43, 42, 43, 42, 47, 43, 47, 21, 22, 22, 22, 22, 22, 22, 43, 22, 22, 17, 22, 22, 22, 17, 22, 22, 22, 17, 22, 17, 0},
+{17, 22, 22, 43, 22, 23, 22, 43, 27, 27, 17, 21, 17, 21, 17, 21, 17, 21, 17, 38, 17, 38, 17, 22, 21, 38, 17, 21, 1, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 27, 22, 27, 22, 27, 22, 27, 22, 43, 22, 43, 22, 43, 42, 43, 42, 47, 43, 38, 21, 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 22, 17, 22, 22, 38, 21, 22, 1, 21, 0},
+{21, 17, 42, 42, 43, 22, 43, 27, 43, 22, 21, 17, 21, 17, 22, 17, 38, 17, 22, 17, 38, 17, 21, 17, 21, 17, 22, 1, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 27, 22, 27, 22, 43, 22, 27, 22, 43, 22, 43, 26, 43, 42, 43, 43, 47, 42, 22, 21, 22, 22, 23, 22, 23, 22, 22, 17, 22, 17, 22, 22, 38, 21, 22, 1, 22, 18, 0}
+},
+{
+{43, 22, 43, 22, 43, 22, 43, 27, 43, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 22, 22, 43, 22, 27, 22, 43, 22, 27, 22, 27, 22, 43, 27, 47, 27, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 0},
+{22, 43, 22, 27, 22, 43, 22, 43, 22, 23, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 23, 22, 43, 22, 43, 22, 43, 22, 27, 22, 43, 22, 43, 27, 47, 26, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 22, 17, 21, 0},
+{43, 22, 43, 22, 43, 22, 43, 22, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 43, 47, 22, 22, 22, 22, 22, 22, 22, 23, 22, 22, 17, 21, 1, 0},
+{22, 43, 22, 43, 22, 43, 22, 43, 22, 23, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 43, 47, 22, 22, 22, 23, 22, 23, 22, 22, 17, 17, 1, 21, 0},
+{43, 22, 43, 22, 43, 22, 43, 22, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 23, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 27, 22, 43, 43, 47, 22, 22, 22, 23, 22, 22, 1, 21, 17, 21, 1, 0},
+{22, 43, 22, 27, 22, 27, 22, 43, 22, 23, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 27, 22, 27, 22, 27, 22, 47, 43, 43, 22, 22, 22, 21, 1, 21, 17, 21, 1, 17, 0},
+{43, 23, 27, 22, 23, 22, 43, 22, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 42, 43, 42, 43, 42, 43, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 23, 22, 43, 22, 43, 22, 43, 22, 27, 22, 27, 22, 27, 22, 27, 22, 47, 43, 43, 17, 17, 17, 21, 17, 21, 17, 21, 1, 0},
+{23, 43, 22, 22, 22, 27, 23, 43, 22, 23, 18, 22, 18, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 38, 22, 43, 22, 43, 22, 43, 42, 43, 42, 43, 42, 43, 42, 43, 22, 23, 22, 23, 22, 22, 22, 22, 22, 43, 22, 43, 22, 43, 22, 27, 22, 27, 22, 27, 22, 27, 22, 27, 27, 47, 22, 17, 1, 21, 17, 21, 17, 21, 1, 21, 0},
+{43, 22, 22, 18, 23, 22, 43, 23, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 22, 22, 22, 22, 39, 22, 43, 22, 43, 26, 43, 42, 43, 42, 43, 42, 43, 42, 43, 22, 22, 22, 22, 22, 22, 22, 23, 22, 43, 22, 23, 22, 27, 22, 27, 22, 27, 22, 27, 22, 27, 22, 43, 22, 21, 1, 21, 1, 21, 17, 21, 17, 21, 17, 0},
+{22, 23, 18, 22, 22, 27, 23, 43, 22, 23, 17, 22, 22, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 22, 22, 22, 22, 22, 22, 43, 22, 43, 22, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 63, 42, 22, 22, 22, 22, 22, 22, 43, 22, 43, 22, 22, 22, 43, 22, 27, 22, 27, 22, 27, 22, 43, 22, 17, 1, 21, 1, 17, 17, 21, 17, 22, 17, 43, 0},
+{23, 18, 22, 18, 23, 22, 43, 23, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 22, 22, 22, 22, 22, 22, 43, 22, 43, 22, 43, 22, 43, 42, 43, 42, 47, 42, 47, 42, 47, 42, 63, 42, 22, 18, 22, 22, 23, 22, 43, 22, 23, 17, 22, 22, 43, 22, 27, 22, 27, 22, 43, 22, 21, 1, 21, 17, 21, 17, 21, 17, 22, 21, 43, 22, 0},
+{18, 22, 18, 22, 22, 27, 23, 43, 22, 23, 18, 22, 22, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 22, 22, 22, 22, 22, 22, 39, 22, 43, 22, 43, 22, 43, 22, 43, 42, 47, 42, 47, 42, 47, 42, 47, 42, 63, 42, 22, 17, 22, 22, 43, 22, 43, 22, 22, 1, 22, 22, 27, 22, 27, 22, 27, 22, 17, 1, 21, 17, 17, 17, 21, 17, 21, 22, 43, 22, 43, 0},
+{22, 18, 22, 18, 23, 22, 43, 22, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 27, 22, 22, 22, 22, 22, 22, 22, 39, 22, 43, 22, 39, 22, 43, 26, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 47, 42, 63, 42, 22, 18, 23, 22, 43, 22, 23, 18, 17, 1, 22, 22, 27, 22, 27, 22, 21, 1, 21, 17, 21, 17, 21, 17, 21, 22, 43, 22, 43, 22, 0},
+{18, 22, 18, 22, 22, 43, 22, 43, 22, 23, 17, 22, 18, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 47, 42, 63, 42, 22, 22, 43, 22, 43, 22, 22, 1, 17, 17, 43, 42, 47, 42, 21, 17, 21, 17, 21, 17, 21, 17, 21, 22, 43, 22, 43, 22, 43, 0},
+{22, 18, 22, 18, 23, 22, 43, 22, 27, 22, 22, 18, 22, 22, 22, 22, 22, 22, 22, 22, 27, 22, 22, 22, 22, 22, 23, 22, 23, 22, 22, 22, 43, 26, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 47, 42, 63, 42, 22, 22, 43, 22, 23, 17, 21, 22, 43, 42, 63, 43, 63, 21, 17, 17, 21, 1, 21, 17, 21, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 27, 23, 43, 22, 23, 18, 22, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 23, 22, 23, 22, 22, 22, 43, 22, 43, 26, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 63, 42, 27, 22, 27, 22, 42, 42, 43, 42, 47, 42, 47, 43, 38, 17, 21, 1, 17, 17, 17, 21, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 22, 22, 22, 23, 22, 43, 23, 43, 22, 22, 18, 22, 22, 22, 22, 22, 22, 22, 27, 23, 22, 22, 22, 22, 22, 23, 22, 39, 22, 43, 22, 43, 22, 43, 26, 43, 26, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 26, 43, 26, 43, 42, 47, 42, 47, 42, 47, 42, 63, 17, 21, 17, 17, 1, 21, 17, 43, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 27, 27, 43, 23, 23, 18, 22, 18, 22, 22, 22, 22, 22, 22, 43, 22, 23, 22, 22, 22, 23, 22, 39, 22, 43, 22, 43, 22, 43, 26, 43, 22, 43, 26, 43, 26, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 43, 42, 63, 42, 21, 1, 21, 1, 21, 17, 43, 22, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 18, 22, 22, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 27, 27, 22, 23, 22, 22, 22, 39, 22, 39, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 26, 43, 22, 43, 26, 43, 42, 43, 42, 43, 26, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 43, 22, 43, 42, 38, 17, 21, 1, 17, 17, 38, 22, 43, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 18, 22, 22, 27, 27, 43, 23, 23, 18, 22, 22, 22, 18, 22, 22, 22, 22, 43, 22, 27, 22, 22, 22, 39, 22, 23, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 26, 43, 42, 43, 42, 43, 42, 43, 42, 47, 42, 47, 22, 43, 22, 43, 17, 21, 17, 21, 17, 38, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 22, 22, 22, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 18, 22, 18, 43, 27, 43, 22, 27, 22, 23, 22, 22, 22, 39, 22, 39, 22, 43, 22, 38, 22, 22, 22, 43, 22, 42, 22, 42, 22, 38, 22, 43, 26, 43, 42, 43, 42, 43, 42, 47, 42, 47, 42, 47, 22, 22, 22, 43, 21, 17, 1, 21, 17, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 23, 22, 27, 27, 43, 23, 23, 18, 22, 18, 22, 22, 22, 22, 22, 22, 47, 27, 23, 22, 22, 22, 22, 22, 23, 22, 39, 22, 43, 22, 38, 22, 38, 17, 38, 22, 38, 17, 22, 17, 17, 17, 42, 42, 43, 42, 43, 42, 43, 42, 43, 42, 47, 26, 38, 22, 22, 22, 43, 22, 17, 1, 21, 17, 21, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 22, 22, 22, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 22, 22, 22, 22, 27, 43, 22, 27, 22, 23, 22, 23, 22, 23, 22, 39, 22, 38, 17, 22, 17, 21, 21, 22, 17, 38, 17, 21, 22, 43, 42, 43, 42, 43, 42, 43, 42, 43, 42, 42, 22, 38, 22, 43, 22, 43, 17, 21, 17, 21, 1, 21, 21, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 27, 27, 43, 23, 23, 17, 22, 18, 22, 22, 22, 22, 22, 18, 43, 27, 43, 22, 23, 22, 22, 22, 23, 22, 39, 22, 22, 17, 22, 17, 17, 17, 21, 17, 38, 17, 38, 22, 43, 42, 43, 42, 43, 42, 43, 42, 43, 22, 22, 21, 38, 22, 43, 27, 42, 1, 17, 17, 21, 1, 21, 17, 42, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 22, 22, 18, 23, 22, 43, 27, 43, 22, 22, 18, 22, 18, 22, 22, 22, 22, 22, 18, 43, 27, 27, 22, 22, 22, 38, 22, 38, 22, 22, 17, 22, 17, 38, 17, 21, 17, 21, 17, 38, 22, 43, 42, 43, 42, 43, 42, 43, 42, 43, 43, 43, 18, 22, 22, 42, 22, 22, 1, 21, 17, 21, 1, 21, 17, 22, 22, 43, 26, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 43, 27, 43, 23, 23, 17, 22, 18, 22, 22, 22, 22, 22, 22, 22, 22, 47, 22, 22, 22, 23, 22, 22, 17, 22, 17, 21, 17, 21, 17, 38, 17, 17, 17, 38, 22, 43, 42, 43, 26, 43, 26, 43, 42, 43, 43, 43, 43, 22, 17, 22, 22, 22, 1, 17, 17, 22, 17, 17, 1, 22, 22, 42, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 22, 22, 18, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 27, 22, 22, 23, 22, 22, 17, 21, 17, 21, 17, 21, 17, 22, 21, 17, 17, 43, 22, 43, 42, 43, 42, 43, 22, 43, 43, 43, 43, 43, 43, 43, 22, 22, 17, 38, 22, 21, 17, 21, 17, 21, 1, 21, 22, 42, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 43, 27, 43, 23, 23, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 27, 22, 23, 22, 22, 17, 21, 17, 22, 17, 21, 17, 21, 17, 21, 21, 43, 22, 43, 42, 43, 42, 43, 22, 43, 26, 43, 43, 43, 43, 47, 43, 43, 18, 17, 21, 38, 17, 21, 17, 21, 1, 21, 17, 42, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 0},
+{22, 22, 22, 18, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 22, 22, 22, 23, 22, 23, 22, 39, 22, 22, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 42, 26, 43, 42, 43, 22, 39, 22, 43, 26, 43, 27, 43, 43, 43, 43, 47, 26, 22, 1, 22, 22, 22, 17, 22, 17, 21, 17, 38, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 43, 22, 0},
+{22, 22, 22, 22, 22, 43, 27, 43, 23, 23, 18, 22, 22, 22, 22, 22, 22, 22, 22, 27, 22, 22, 22, 22, 17, 22, 17, 21, 17, 21, 17, 17, 17, 21, 17, 43, 26, 43, 26, 43, 22, 23, 22, 22, 18, 22, 22, 43, 43, 43, 43, 43, 22, 22, 18, 17, 17, 42, 17, 22, 17, 21, 17, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 42, 0},
+{22, 22, 22, 18, 23, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 18, 22, 22, 27, 22, 23, 17, 21, 17, 38, 21, 21, 17, 21, 17, 22, 17, 17, 17, 43, 26, 43, 42, 38, 1, 22, 1, 22, 17, 22, 22, 39, 22, 43, 43, 38, 17, 22, 1, 22, 1, 21, 22, 22, 17, 21, 1, 21, 21, 42, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 0},
+{22, 22, 18, 22, 22, 43, 27, 43, 27, 23, 18, 22, 22, 22, 22, 22, 22, 43, 26, 22, 17, 21, 17, 22, 17, 38, 17, 21, 17, 21, 1, 17, 17, 38, 22, 43, 42, 43, 22, 22, 22, 22, 38, 43, 22, 23, 22, 43, 43, 43, 17, 22, 22, 22, 1, 17, 17, 42, 21, 22, 1, 21, 17, 38, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 42, 0},
+{22, 22, 22, 17, 22, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 22, 42, 22, 22, 17, 38, 17, 21, 17, 38, 37, 38, 17, 17, 17, 21, 1, 22, 22, 43, 42, 23, 22, 43, 22, 23, 22, 43, 22, 43, 22, 23, 22, 47, 22, 39, 22, 22, 17, 22, 1, 22, 22, 22, 17, 21, 1, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 43, 26, 43, 26, 0},
+{22, 22, 18, 22, 22, 43, 27, 43, 27, 27, 18, 22, 22, 22, 22, 38, 21, 22, 17, 38, 21, 38, 17, 38, 21, 38, 21, 21, 1, 21, 17, 22, 22, 43, 22, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 39, 22, 39, 43, 43, 22, 43, 22, 22, 17, 21, 17, 38, 22, 21, 1, 21, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 43, 26, 43, 26, 43, 0},
+{22, 18, 22, 1, 22, 22, 43, 27, 43, 22, 22, 18, 22, 22, 38, 21, 22, 17, 38, 21, 38, 17, 17, 17, 38, 17, 22, 21, 17, 17, 21, 22, 43, 22, 22, 22, 23, 22, 43, 22, 43, 26, 43, 22, 43, 22, 23, 22, 43, 43, 43, 22, 39, 22, 22, 17, 22, 22, 38, 1, 21, 17, 42, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 43, 27, 43, 27, 43, 27, 0},
+{17, 22, 17, 22, 18, 43, 27, 43, 27, 27, 18, 22, 22, 38, 21, 38, 21, 38, 17, 38, 17, 21, 17, 21, 17, 21, 22, 22, 17, 17, 22, 43, 26, 21, 17, 23, 22, 23, 22, 43, 23, 43, 22, 43, 22, 23, 22, 23, 42, 47, 22, 43, 22, 23, 17, 21, 17, 22, 22, 21, 17, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 43, 27, 43, 27, 47, 43, 47, 0},
+{22, 17, 22, 1, 22, 22, 43, 27, 43, 22, 22, 22, 38, 22, 22, 21, 38, 17, 38, 37, 38, 17, 17, 17, 22, 22, 38, 17, 21, 17, 43, 26, 21, 17, 22, 22, 23, 22, 43, 22, 43, 22, 43, 22, 23, 22, 23, 22, 43, 43, 43, 22, 23, 22, 21, 17, 22, 17, 43, 17, 21, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 43, 27, 43, 27, 47, 43, 47, 43, 0},
+{17, 22, 17, 22, 18, 43, 27, 43, 27, 27, 18, 22, 22, 38, 17, 38, 17, 38, 17, 38, 21, 21, 17, 17, 17, 22, 17, 17, 21, 43, 22, 22, 1, 22, 18, 23, 22, 23, 22, 43, 22, 43, 22, 43, 22, 23, 22, 23, 22, 43, 22, 43, 22, 22, 17, 22, 1, 22, 22, 22, 17, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 43, 27, 43, 27, 47, 43, 47, 43, 47, 0},
+{22, 17, 22, 17, 22, 22, 43, 27, 43, 22, 22, 18, 22, 22, 22, 17, 38, 17, 38, 21, 38, 17, 22, 21, 21, 17, 22, 21, 22, 26, 22, 17, 17, 17, 22, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 22, 23, 22, 43, 26, 43, 22, 22, 17, 21, 17, 22, 1, 42, 21, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 26, 43, 27, 47, 43, 47, 43, 47, 43, 0},
+{17, 22, 1, 22, 22, 43, 23, 43, 27, 27, 18, 22, 22, 38, 17, 38, 17, 21, 17, 38, 21, 38, 17, 22, 17, 38, 38, 22, 22, 22, 17, 21, 17, 22, 22, 23, 22, 23, 22, 39, 22, 43, 22, 43, 22, 43, 22, 43, 43, 43, 22, 23, 17, 21, 17, 22, 17, 17, 22, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 43, 27, 47, 43, 47, 43, 47, 43, 47, 0},
+{22, 1, 22, 17, 22, 22, 43, 27, 43, 22, 22, 22, 22, 22, 22, 17, 21, 17, 38, 17, 38, 21, 38, 17, 42, 42, 42, 22, 21, 17, 21, 1, 22, 17, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 43, 22, 43, 22, 39, 17, 21, 17, 22, 17, 22, 1, 22, 22, 27, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 27, 47, 43, 47, 43, 47, 43, 47, 43, 0},
+{1, 22, 1, 22, 22, 43, 27, 43, 27, 27, 22, 22, 22, 22, 17, 21, 17, 21, 37, 38, 21, 38, 21, 39, 42, 43, 22, 22, 1, 21, 1, 22, 17, 22, 17, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 39, 22, 43, 22, 39, 22, 21, 17, 21, 17, 22, 17, 22, 21, 43, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 43, 43, 47, 43, 47, 43, 47, 43, 47, 0},
+{21, 1, 22, 17, 22, 22, 43, 27, 43, 22, 22, 22, 38, 17, 38, 17, 22, 21, 38, 21, 38, 21, 38, 22, 43, 22, 22, 17, 21, 17, 21, 17, 22, 17, 22, 17, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 39, 22, 43, 22, 21, 17, 21, 1, 22, 17, 22, 17, 22, 22, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 43, 43, 47, 43, 47, 43, 47, 43, 47, 43, 0},
+{1, 21, 1, 22, 22, 43, 27, 43, 27, 27, 18, 38, 17, 22, 17, 21, 17, 38, 37, 42, 21, 38, 22, 38, 42, 22, 17, 21, 17, 21, 17, 21, 1, 22, 17, 22, 1, 22, 22, 23, 22, 39, 22, 43, 22, 43, 22, 43, 22, 22, 17, 21, 17, 21, 17, 22, 17, 22, 17, 43, 22, 43, 22, 43, 22, 43, 22, 42, 22, 42, 22, 47, 43, 47, 43, 47, 43, 47, 43, 47, 0},
+{21, 1, 22, 22, 23, 22, 43, 27, 43, 22, 22, 18, 22, 17, 21, 17, 21, 21, 38, 21, 38, 37, 38, 21, 22, 17, 21, 17, 22, 17, 21, 1, 21, 1, 22, 17, 22, 1, 22, 22, 23, 22, 43, 22, 43, 22, 43, 22, 22, 17, 21, 17, 22, 1, 22, 17, 22, 17, 22, 22, 43, 22, 43, 22, 43, 22, 42, 22, 42, 22, 43, 43, 47, 43, 47, 43, 47, 43, 43, 22, 0},
+{17, 17, 1, 22, 22, 43, 26, 43, 27, 27, 22, 38, 17, 22, 17, 21, 17, 21, 38, 38, 21, 38, 37, 42, 22, 22, 17, 21, 17, 21, 17, 21, 1, 21, 17, 22, 1, 22, 18, 22, 22, 23, 22, 43, 22, 43, 22, 43, 22, 22, 17, 21, 17, 21, 17, 22, 17, 22, 21, 43, 22, 22, 22, 42, 22, 42, 22, 42, 22, 38, 26, 47, 43, 47, 43, 47, 26, 22, 1, 21, 0},
+{22, 17, 21, 1, 22, 22, 43, 27, 43, 22, 22, 21, 21, 17, 22, 17, 22, 17, 38, 21, 38, 21, 38, 21, 38, 22, 22, 17, 22, 17, 21, 17, 21, 17, 21, 17, 22, 18, 23, 22, 23, 22, 39, 22, 43, 22, 43, 26, 43, 42, 43, 22, 21, 1, 22, 17, 22, 17, 22, 22, 42, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 27, 47, 43, 43, 22, 22, 1, 22, 17, 0},
+{22, 42, 21, 22, 17, 27, 22, 43, 27, 43, 22, 22, 1, 17, 21, 22, 21, 22, 17, 38, 21, 38, 21, 42, 38, 38, 21, 22, 17, 22, 17, 21, 17, 21, 17, 22, 17, 22, 22, 23, 22, 23, 22, 39, 22, 43, 22, 43, 42, 43, 43, 47, 42, 42, 17, 22, 17, 22, 22, 43, 22, 43, 22, 42, 22, 22, 22, 22, 22, 22, 27, 47, 43, 43, 22, 22, 17, 22, 18, 22, 0},
+{38, 22, 42, 21, 22, 22, 43, 27, 43, 22, 42, 17, 21, 17, 21, 17, 22, 17, 21, 17, 21, 17, 38, 21, 42, 21, 38, 21, 17, 17, 21, 17, 21, 17, 22, 17, 22, 17, 23, 22, 23, 22, 23, 22, 43, 22, 43, 26, 43, 26, 43, 43, 47, 43, 43, 17, 22, 17, 22, 22, 43, 22, 42, 22, 42, 22, 38, 22, 23, 22, 47, 43, 47, 22, 22, 18, 22, 22, 22, 22, 0},
+{17, 42, 42, 38, 1, 27, 27, 43, 27, 27, 22, 21, 17, 21, 17, 17, 21, 21, 17, 21, 17, 38, 21, 38, 38, 42, 17, 42, 17, 21, 17, 21, 17, 21, 1, 22, 18, 22, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 26, 43, 26, 43, 43, 47, 43, 42, 1, 17, 22, 43, 22, 43, 22, 42, 22, 42, 22, 22, 22, 43, 43, 47, 27, 22, 18, 22, 22, 22, 22, 22, 0},
+{17, 21, 42, 22, 21, 22, 43, 27, 43, 22, 22, 17, 21, 17, 21, 17, 38, 17, 21, 17, 21, 17, 38, 17, 42, 38, 22, 38, 21, 17, 22, 17, 21, 17, 22, 22, 22, 17, 23, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 26, 43, 43, 47, 43, 47, 43, 22, 1, 27, 22, 43, 22, 42, 22, 42, 22, 22, 22, 47, 27, 47, 27, 27, 18, 22, 22, 22, 22, 22, 22, 0},
+{1, 38, 42, 42, 1, 27, 27, 43, 27, 27, 21, 21, 1, 21, 17, 22, 17, 21, 17, 17, 17, 21, 17, 38, 38, 38, 22, 42, 17, 22, 17, 21, 1, 22, 22, 23, 18, 22, 22, 23, 22, 23, 22, 23, 22, 43, 22, 43, 22, 43, 26, 43, 43, 47, 43, 63, 26, 21, 22, 43, 22, 42, 22, 42, 22, 42, 22, 43, 43, 47, 43, 43, 22, 22, 22, 22, 18, 22, 22, 22, 0},
+{17, 21, 42, 22, 22, 22, 43, 27, 43, 22, 22, 17, 17, 17, 21, 17, 22, 17, 21, 17, 21, 17, 21, 21, 38, 21, 22, 17, 22, 17, 22, 17, 21, 17, 23, 22, 22, 22, 23, 22, 23, 22, 23, 22, 27, 22, 43, 22, 43, 22, 43, 42, 43, 43, 47, 43, 47, 21, 43, 22, 42, 22, 42, 22, 42, 22, 27, 27, 47, 43, 47, 22, 22, 22, 22, 18, 22, 22, 22, 21, 0},
+{1, 22, 38, 42, 17, 23, 27, 43, 27, 43, 22, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 38, 21, 22, 21, 38, 1, 21, 1, 21, 1, 22, 22, 23, 17, 23, 22, 23, 22, 23, 22, 23, 22, 27, 22, 43, 22, 43, 26, 43, 42, 43, 43, 47, 43, 43, 22, 22, 22, 42, 22, 42, 22, 42, 22, 27, 26, 47, 27, 23, 22, 22, 18, 22, 22, 22, 21, 22, 0},
+{17, 17, 42, 26, 22, 22, 43, 27, 43, 22, 22, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 38, 21, 21, 17, 22, 17, 21, 1, 17, 1, 22, 22, 23, 18, 22, 22, 23, 22, 27, 22, 23, 22, 23, 22, 27, 22, 43, 22, 43, 26, 43, 42, 47, 43, 47, 42, 22, 17, 22, 21, 22, 22, 22, 22, 27, 22, 43, 27, 27, 18, 22, 18, 22, 22, 22, 22, 22, 17, 0},
+{1, 22, 22, 43, 21, 23, 22, 43, 27, 27, 22, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 42, 21, 38, 17, 21, 1, 17, 1, 22, 22, 23, 18, 22, 22, 23, 22, 23, 22, 27, 22, 23, 22, 23, 22, 27, 22, 43, 22, 43, 26, 43, 43, 47, 43, 47, 22, 22, 22, 22, 17, 21, 1, 22, 26, 27, 27, 27, 17, 22, 17, 22, 22, 22, 21, 22, 17, 22, 0},
+{22, 22, 42, 42, 22, 22, 43, 27, 43, 22, 22, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 21, 17, 38, 21, 21, 1, 17, 1, 22, 18, 22, 1, 22, 22, 23, 22, 23, 22, 23, 22, 27, 22, 23, 22, 27, 22, 27, 22, 43, 22, 43, 42, 43, 43, 47, 43, 43, 22, 22, 22, 22, 17, 22, 22, 43, 27, 27, 17, 22, 17, 22, 22, 22, 17, 22, 21, 22, 17, 0},
+{17, 22, 22, 43, 22, 23, 22, 43, 27, 27, 17, 17, 17, 21, 17, 21, 17, 22, 17, 22, 17, 21, 17, 21, 21, 22, 17, 21, 1, 21, 1, 22, 17, 22, 22, 23, 22, 23, 22, 23, 22, 27, 22, 27, 22, 27, 22, 27, 22, 43, 22, 43, 26, 43, 42, 43, 43, 47, 42, 22, 22, 22, 22, 22, 22, 22, 22, 22, 17, 22, 17, 22, 22, 22, 17, 22, 22, 22, 17, 22, 0},
+{21, 17, 42, 42, 42, 22, 43, 27, 43, 22, 21, 17, 21, 17, 21, 17, 21, 17, 22, 21, 21, 21, 21, 17, 38, 17, 21, 1, 22, 1, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 27, 22, 43, 22, 27, 22, 27, 22, 43, 22, 43, 26, 43, 42, 47, 43, 47, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 17, 22, 17, 22, 17, 22, 22, 22, 17, 21, 1, 0},
+{1, 21, 22, 47, 26, 23, 22, 43, 27, 22, 17, 21, 17, 21, 17, 21, 17, 21, 17, 22, 21, 22, 17, 22, 17, 38, 17, 22, 2, 22, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 23, 22, 27, 22, 27, 22, 43, 22, 43, 22, 43, 22, 43, 26, 43, 42, 47, 43, 43, 21, 22, 22, 22, 22, 23, 22, 23, 22, 22, 17, 22, 17, 22, 22, 22, 17, 21, 17, 22, 0}
+}
+};
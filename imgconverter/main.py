@@ -1,50 +1,77 @@
+import argparse
+import time
 import cv2 as cv
 import numpy as np
-import sys
+import quantize
 
-colors = np.zeros((2 ** 6, 3))
 
+# split an image into two frames of palette levels that average out to the original color
+# shown alternately at 60 Hz each 2 bit channel gets 7 perceived levels (0, 42, 85, ... 255) instead of 4,
+# and each 3 bit channel 15 instead of 8
+def splitDither(img: np.ndarray, palette: str = 'bgr222'):
+    tops = np.array([2 ** bits - 1 for bits, _ in quantize.PALETTES[palette]])
+    halves = np.rint(img.astype(np.float64) * 2 * tops / 255).astype(np.uint8)  # target in half-levels
+    low = halves // 2
+    high = halves - low  # never more than one level above low
 
-def genColorMap():
-    for val in range(2 ** 6):
-        b = '{:6b}'.format(val)  # msb to lsb
-        for i in [0, 1, 2]:  # blue is msb, then green, then red
-            if b[0] == '1':  # high bit
-                colors[val, i] += 170
-            if b[1] == '1':  # low bit
-                colors[val, i] += 85
-            b = b[2:]
+    # swap the two frames on alternating pixels so the flicker is spread over a checkerboard
+    # instead of whole areas of the image pulsing together
+    ys, xs = np.indices(img.shape[:2])
+    swap = ((xs + ys) % 2 == 1)[:, :, np.newaxis]
+    first = np.where(swap, high, low)
+    second = np.where(swap, low, high)
 
+    return [quantize.packLevels(first, palette), quantize.packLevels(second, palette)]
 
-# use the squared distance between the image color and the color list to find the closest match
-def getColorMatch(color: np.ndarray((3,))):
-    difs = colors - color
-    difs = difs ** 2
-    dists = np.sum(difs, 1)
-    return np.argmin(dists)
+
+def writeImage(imgName: str, pixels: np.ndarray):
+    rows = [', '.join(str(v) for v in row) for row in pixels]
+    with open(imgName + '.c', 'w') as outf:
+        outf.write('const char {}[4800] = {{\n'.format(imgName))
+        outf.write(', \n'.join(rows))
+        outf.write('\n};\n')
+
+
+# the dithered frames are scanned out directly from flash, so every row carries the extra zero edge pixel
+# that the screen buffer normally provides (see setupHorizontalTimers)
+def writeDither(imgName: str, img: np.ndarray, palette: str):
+    frames = splitDither(img, palette)
+    name = imgName + 'Dither'
+    with open(name + '.c', 'w') as outf:
+        outf.write('const char {}[2][60][81] = {{\n'.format(name))
+        for f, frame in enumerate(frames):
+            outf.write('{\n')
+            for x in range(60):
+                outf.write('{' + ', '.join(str(v) for v in frame[x]) + ', 0}')
+                outf.write(',\n' if x != 59 else '\n')
+            outf.write('},\n' if f == 0 else '}\n')
+        outf.write('};\n')
 
 
 def main():
-    if len(sys.argv) < 2:
-        print('Usage: {} filename'.format(sys.argv[0]))
-        return -1
+    parser = argparse.ArgumentParser(description='Convert an image into a C array for the VGA framebuffer')
+    parser.add_argument('filename')
+    parser.add_argument('--dither', action='store_true',
+                        help='emit a pair of frames for temporal dithering instead of a single image')
+    parser.add_argument('--quantize', choices=['nearest', 'floyd', 'ordered'], default='nearest',
+                        help='how to map pixels onto the palette')
+    parser.add_argument('--palette', choices=sorted(quantize.PALETTES), default='bgr222',
+                        help='how the DAC is wired: 6 bit BGR222 or 8 bit RGB332')
+    args = parser.parse_args()
 
-    genColorMap()
+    colors = quantize.genColorMap(args.palette)
 
-    nameIn: str = sys.argv[1]
+    nameIn: str = args.filename
     imgName = ''.join(nameIn.split('.')[0:-1])  # get the name of the file itself
 
     img = cv.imread(nameIn)
     img = cv.resize(img, (80, 60), interpolation=cv.INTER_AREA)
-    with open(imgName + '.c', 'w') as outf:
-        outf.write('const char {}[4800] = {{\n'.format(imgName))
-        for x in range(60):
-            for y in range(80):
-                outf.write('{}'.format(getColorMatch(img[x, y])))
-                if x != 59 or y != 79:
-                    outf.write(', ')
-            outf.write('\n')
-        outf.write('};\n')
+    start = time.perf_counter()
+    if args.dither:
+        writeDither(imgName, img, args.palette)
+    else:
+        writeImage(imgName, quantize.quantize(colors, img, args.quantize, quantize.paletteStep(args.palette)))
+    print('converted {} in {:.3f} s'.format(nameIn, time.perf_counter() - start))
 
 
 if __name__ == '__main__':
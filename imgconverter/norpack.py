@@ -0,0 +1,66 @@
+import argparse
+import os
+import struct
+import time
+from multiprocessing import Pool
+import batch
+import quantize
+
+# must match inc/stream.h
+MAGIC = 0x564d5453  # 'STMV'
+HEADER = struct.Struct('<IIHBBI')  # magic, frames, frame size, palette, format, data offset
+FORMAT_RAW = 0  # width + 1 bytes per row, ending in the zero edge pixel, read straight into the screen buffer
+
+ALIGN = 256  # a page, so a frame read never starts part way into one more than it has to
+
+
+# an indexed frame in the scan-out layout, with the zero edge pixel at the end of each row
+def scanout(data: bytes, size):
+    width, height = size
+    return b''.join(data[y * width:(y + 1) * width] + b'\0' for y in range(height))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a video, GIF or directory of images into an SPI flash image')
+    parser.add_argument('input')
+    parser.add_argument('-o', '--output', default='nor.bin')
+    parser.add_argument('--size', default='80x60', help='frame geometry, WIDTHxHEIGHT, which has to be the screen\'s')
+    parser.add_argument('--fps', type=float, default=batch.REFRESH,
+                        help='frame rate for image directories and inputs that don\'t report one')
+    parser.add_argument('--quantize', choices=['nearest', 'floyd', 'ordered'], default='nearest')
+    parser.add_argument('--palette', choices=sorted(quantize.PALETTES), default='bgr222',
+                        help='how the DAC is wired, which has to match PALETTE in inc/vga.h')
+    parser.add_argument('--cache', default='.cache', help='directory for converted frames')
+    parser.add_argument('--jobs', type=int, default=os.cpu_count())
+    parser.add_argument('--limit', type=int, default=16 * 1024 * 1024, help='size of the flash part')
+    args = parser.parse_args()
+
+    size = tuple(int(v) for v in args.size.lower().split('x'))
+    os.makedirs(args.cache, exist_ok=True)
+    start = time.perf_counter()
+
+    with Pool(args.jobs) as pool:
+        results = list(batch.convertClip(pool, args.input, args.fps, size, args.quantize, args.palette, args.cache))
+    frames, ticks = batch.collapse([data for data, _, _ in results], batch.toTicks([d for _, _, d in results]))
+    ticks = [min(t, 0xFFFF) for t in ticks]
+
+    frameSize = (size[0] + 1) * size[1]
+    durations = struct.pack('<{}H'.format(len(ticks)), *ticks)
+    dataOffset = HEADER.size + len(durations)
+    dataOffset += -dataOffset % ALIGN
+    image = HEADER.pack(MAGIC, len(frames), frameSize, quantize.PALETTE_IDS[args.palette], FORMAT_RAW, dataOffset)
+    image += durations
+    image += b'\xff' * (dataOffset - len(image))  # left erased
+    image += b''.join(scanout(data, size) for data in frames)
+
+    if len(image) > args.limit:
+        raise SystemExit('{} bytes of video does not fit in the {} byte flash'.format(len(image), args.limit))
+    with open(args.output, 'wb') as outf:
+        outf.write(image)
+    hits = sum(1 for _, hit, _ in results if hit)
+    print('{} source frames ({} cached) -> {} frames, {} bytes, {:.2f} s of video, in {:.3f} s'.format(
+        len(results), hits, len(frames), len(image), sum(ticks) / batch.REFRESH, time.perf_counter() - start))
+
+
+if __name__ == '__main__':
+    main()
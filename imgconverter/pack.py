@@ -0,0 +1,205 @@
+import argparse
+import os
+import struct
+import time
+import cv2 as cv
+import numpy as np
+import batch
+import main as converter
+import quantize
+import vq
+
+# must match inc/assets.h
+MAGIC = 0x414d5453  # 'STMA'
+HEADER = struct.Struct('<II')  # magic, count
+ENTRY = struct.Struct('<HHHHBB2xIII')  # id, width, height, frames, format, palette, offset, length, crc
+
+FORMAT_INDEXED = 0  # width bytes per row, copied into the screen buffer
+FORMAT_SCANOUT = 1  # width + 1 bytes per row, ending in the zero edge pixel so the DMA can read it directly
+FORMAT_MONO = 2  # a bit per pixel, msb first, then a zero edge byte per row, for the mono video mode
+FORMAT_FIELDS = 3  # like indexed but twice as many rows, for the field video mode
+FORMAT_VQ = 4  # blocks out of a dictionary shared by all the frames, see imgconverter/vq.py
+FORMAT_PACKED = 5  # 2 or 4 bits a pixel indexing a palette of the DAC's colours picked for the asset
+
+# must match packedHeader in inc/packed.h: bits a pixel, 3 reserved bytes, then the palette
+PACKED_HEADER = struct.Struct('<B3x16s')
+
+MONO_SIZE = (400, 100)  # MONO_WIDTH and MONO_HEIGHT in inc/vga.h
+BLACK_WHITE = np.array([[0, 0, 0], [255, 255, 255]])
+
+# CRC-32 as computed by the STM32 CRC unit with its reset settings (poly 0x04C11DB7, init 0xFFFFFFFF,
+# no reflection, no final xor), fed one 32 bit word at a time. The word is read little endian from flash
+# and shifted in msb first, so pad to a whole word and reverse each group of four bytes
+def stmCrc(data: bytes):
+    data = data + bytes(-len(data) % 4)
+    crc = 0xFFFFFFFF
+    for i in range(0, len(data), 4):
+        crc ^= int.from_bytes(data[i:i + 4], 'little')
+        for _ in range(32):
+            crc = ((crc << 1) ^ 0x04C11DB7) if crc & 0x80000000 else crc << 1
+            crc &= 0xFFFFFFFF
+    return crc
+
+
+def loadImage(path: str, size):
+    return cv.resize(cv.imread(path), size, interpolation=cv.INTER_AREA)
+
+
+# every frame of a clip (or the one of an image), as an (n, h, w, 3) array
+def loadClip(path: str, size):
+    return np.array([cv.resize(img, size, interpolation=cv.INTER_AREA) for img, _ in batch.readFrames(path, batch.REFRESH)])
+
+
+# palette indices, (n, h, w), packed into bytes of bits a pixel, the first pixel of each byte in its high bits
+def packPixels(indices: np.ndarray, bits: int):
+    per = 8 // bits
+    groups = indices.astype(np.uint8).reshape(-1, per)
+    shifts = np.arange(per - 1, -1, -1, dtype=np.uint8) * bits
+    return np.bitwise_or.reduce(groups << shifts, axis=1).astype(np.uint8).tobytes()
+
+
+# the pixel bytes of every frame of a packed asset, (frames, h, w)
+def unpackPixels(data: bytes, size):
+    bits, palette = PACKED_HEADER.unpack_from(data)
+    per = 8 // bits
+    packed = np.frombuffer(data, np.uint8, offset=PACKED_HEADER.size)
+    shifts = np.arange(per - 1, -1, -1, dtype=np.uint8) * bits
+    indices = (packed[:, np.newaxis] >> shifts) & ((1 << bits) - 1)
+    return np.frombuffer(palette, np.uint8)[indices].reshape(-1, size[1], size[0])
+
+
+# each asset spec is [kind:]file, where kind is image (default), dither, anim, mono, fields, or vq2 or vq4 (a clip
+# coded as 2x2 or 4x4 blocks), or pal4 or pal16 (an image or clip in 2 or 4 bits a pixel, with a palette of 4 or 16
+# of the DAC's colours picked for it)
+def buildAsset(spec: str, size, method: str, palette: str, cacheDir: str):
+    kind, _, path = spec.rpartition(':')
+    kind = kind or 'image'
+    name = os.path.splitext(os.path.basename(os.path.normpath(path)))[0]
+
+    if kind == 'image':
+        colors = quantize.genColorMap(palette)
+        step = quantize.paletteStep(palette)
+        data = quantize.quantize(colors, loadImage(path, size), method, step).astype(np.uint8).tobytes()
+        return name, FORMAT_INDEXED, 1, data
+    if kind == 'dither':
+        frames = converter.splitDither(loadImage(path, size), palette)
+        edge = [np.pad(f, ((0, 0), (0, 1))).astype(np.uint8) for f in frames]
+        return name + 'Dither', FORMAT_SCANOUT, 2, b''.join(f.tobytes() for f in edge)
+    if kind == 'anim':
+        sources = list(batch.readFrames(path, batch.REFRESH))
+        data = [batch.convertFrame((img, size, method, palette, cacheDir))[0] for img, _ in sources]
+        return name, FORMAT_INDEXED, len(data), b''.join(data)
+    if kind == 'mono':
+        bits = quantize.quantize(BLACK_WHITE, loadImage(path, MONO_SIZE), method, 255)
+        rows = np.pad(np.packbits(bits.astype(np.uint8), axis=1), ((0, 0), (0, 1)))
+        return name + 'Mono', FORMAT_MONO, 1, rows.tobytes()
+    if kind == 'fields':
+        colors = quantize.genColorMap(palette)
+        img = loadImage(path, (size[0], 2 * size[1]))
+        data = quantize.quantize(colors, img, method, quantize.paletteStep(palette)).astype(np.uint8).tobytes()
+        return name + 'Fields', FORMAT_FIELDS, 1, data
+    if kind in ('vq2', 'vq4'):
+        block = int(kind[2])
+        imgs = loadClip(path, size)
+        dictionary, indices = vq.encode(imgs, block, 256, palette)
+        return name + 'Vq', FORMAT_VQ, len(imgs), vq.pack(block, dictionary, indices)
+    if kind in ('pal4', 'pal16'):
+        entries = int(kind[3:])
+        imgs = loadClip(path, size)
+        colors = quantize.genColorMap(palette)
+        chosen = quantize.choosePalette(colors, imgs, entries)
+        indices = quantize.quantize(colors[chosen], imgs, method, quantize.paletteStep(palette))
+        bits = 2 if entries == 4 else 4
+        header = PACKED_HEADER.pack(bits, np.resize(chosen, 16).tobytes())
+        return name + 'Pal' + str(entries), FORMAT_PACKED, len(imgs), header + packPixels(indices, bits)
+    raise ValueError('unknown asset kind {}'.format(kind))
+
+
+# what each frame should look like on the monitor, for m0sim/scanout.py to compare the simulated scan-out against
+def writeGolden(directory: str, i: int, name: str, fmt: int, frames: int, data: bytes, size, palette: str):
+    if fmt == FORMAT_MONO:
+        colors = BLACK_WHITE
+        rows = np.frombuffer(data, np.uint8).reshape(frames, MONO_SIZE[1], -1)[:, :, :-1]
+        pixels = np.unpackbits(rows, axis=2)
+    else:
+        colors = quantize.genColorMap(palette)
+        width = size[0] + 1 if fmt == FORMAT_SCANOUT else size[0]
+        if fmt == FORMAT_VQ:
+            pixels = vq.decode(data, size)
+        elif fmt == FORMAT_PACKED:
+            pixels = unpackPixels(data, size)
+        else:
+            pixels = np.frombuffer(data, np.uint8).reshape(frames, -1, width)[:, :, :size[0]]
+    for f in range(frames):
+        cv.imwrite(os.path.join(directory, '{:02}-{}-{}.png'.format(i, name, f)), colors[pixels[f]].astype(np.uint8))
+
+
+# width and height as stored in the index
+def geometry(fmt: int, size):
+    if fmt == FORMAT_MONO:
+        return MONO_SIZE
+    if fmt == FORMAT_FIELDS:
+        return size[0], 2 * size[1]
+    return size[0] + 1 if fmt == FORMAT_SCANOUT else size[0], size[1]
+
+
+def writeHeader(path: str, names):
+    with open(path, 'w') as outf:
+        outf.write('// generated by imgconverter/pack.py, do not edit\n')
+        outf.write('#ifndef ASSETIDS_H\n#define ASSETIDS_H\n\n')
+        for i, name in enumerate(names):
+            outf.write('#define ASSET_{} {}\n'.format(name.upper(), i))
+        outf.write('\n#endif\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack images into a binary asset region with an index')
+    parser.add_argument('assets', nargs='+',
+                        help='[image|dither|anim|mono|fields|vq2|vq4|pal4|pal16:]file, ids are given in order')
+    parser.add_argument('-o', '--output', default='assets.bin')
+    parser.add_argument('--header', default='assetids.h', help='where to write the ASSET_* id defines')
+    parser.add_argument('--size', default='80x60', help='frame geometry, WIDTHxHEIGHT')
+    parser.add_argument('--quantize', choices=['nearest', 'floyd', 'ordered'], default='nearest')
+    parser.add_argument('--palette', choices=sorted(quantize.PALETTES), default='bgr222',
+                        help='how the DAC is wired, which has to match PALETTE in inc/vga.h')
+    parser.add_argument('--cache', default='.cache', help='directory for converted animation frames')
+    parser.add_argument('--limit', type=int, default=32 * 1024, help='size of the ASSETS region in LinkerScript.ld')
+    parser.add_argument('--golden', help='also write the expected picture of every frame here, as PNGs')
+    args = parser.parse_args()
+
+    size = tuple(int(v) for v in args.size.lower().split('x'))
+    os.makedirs(args.cache, exist_ok=True)
+    start = time.perf_counter()
+
+    assets = [buildAsset(spec, size, args.quantize, args.palette, args.cache) for spec in args.assets]
+
+    # index first, then every asset's data word aligned so the firmware can read it a word at a time
+    offset = HEADER.size + ENTRY.size * len(assets)
+    index = HEADER.pack(MAGIC, len(assets))
+    blob = b''
+    for i, (name, fmt, frames, data) in enumerate(assets):
+        width, height = geometry(fmt, size)
+        index += ENTRY.pack(i, width, height, frames, fmt, quantize.PALETTE_IDS[args.palette],
+                            offset + len(blob), len(data), stmCrc(data))
+        blob += data + bytes(-len(data) % 4)
+        print('{:3} {:16} {}x{} x{} {} bytes'.format(i, name, width, height, frames, len(data)))
+        if fmt == FORMAT_VQ:
+            print('    ' + vq.report(data, frames, size))
+        if fmt == FORMAT_PACKED:
+            bits, palette = PACKED_HEADER.unpack_from(data)
+            print('    palette ' + ' '.join(str(c) for c in palette[:1 << bits]))
+        if args.golden:
+            os.makedirs(args.golden, exist_ok=True)
+            writeGolden(args.golden, i, name, fmt, frames, data, size, args.palette)
+
+    image = index + blob
+    if len(image) > args.limit:
+        raise SystemExit('{} bytes of assets does not fit in the {} byte region'.format(len(image), args.limit))
+    with open(args.output, 'wb') as outf:
+        outf.write(image)
+    writeHeader(args.header, [a[0] for a in assets])
+    print('packed {} assets into {} bytes in {:.3f} s'.format(len(assets), len(image), time.perf_counter() - start))
+
+
+if __name__ == '__main__':
+    main()
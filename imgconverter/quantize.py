@@ -0,0 +1,129 @@
+import numpy as np
+
+
+# how the DAC is wired to the pixel byte: (bits, shift) for blue, green and red (cv's channel order)
+# must match the PALETTE_* defines in inc/vga.h, and the palette ids are stored with each asset
+PALETTES = {
+    'bgr222': ((2, 4), (2, 2), (2, 0)),  # 64 colors on PB0..5, blue in the high bits
+    'rgb332': ((2, 0), (3, 2), (3, 5)),  # 256 colors on all of PB0..7, red in the high bits
+}
+PALETTE_IDS = {'bgr222': 0, 'rgb332': 1}
+
+
+# the colors the DAC can make, indexed the same way as the pixel byte
+def genColorMap(palette: str = 'bgr222'):
+    channels = PALETTES[palette]
+    colors = np.zeros((2 ** sum(bits for bits, _ in channels), 3))
+    for val in range(len(colors)):
+        for i, (bits, shift) in enumerate(channels):
+            top = 2 ** bits - 1
+            colors[val, i] = np.rint(((val >> shift) & top) * 255 / top)
+    return colors
+
+
+# the gap between neighbouring levels of each channel, for ordered dithering
+def paletteStep(palette: str = 'bgr222'):
+    return np.array([255 / (2 ** bits - 1) for bits, _ in PALETTES[palette]])
+
+
+# pack per-channel levels (an (..., 3) array, blue green red) into pixel bytes
+def packLevels(levels: np.ndarray, palette: str = 'bgr222'):
+    out = np.zeros(levels.shape[:-1], dtype=np.uint8)
+    for i, (_, shift) in enumerate(PALETTES[palette]):
+        out |= (levels[..., i] << shift).astype(np.uint8)
+    return out
+
+
+# 4x4 Bayer matrix, normalized to thresholds in [-0.5, 0.5)
+bayer = (np.array([[0, 8, 2, 10],
+                   [12, 4, 14, 6],
+                   [3, 11, 1, 9],
+                   [15, 7, 13, 5]]) + 0.5) / 16 - 0.5
+
+
+# index of the closest palette color for every pixel of an (..., 3) array
+# the squared distance |p - c|^2 = |p|^2 - 2 p.c + |c|^2, and |p|^2 is the same for every color so it can be dropped.
+# that leaves a single matrix multiply, done in chunks so a whole clip doesn't need a huge distance table at once
+def nearest(colors: np.ndarray, pixels: np.ndarray, chunk: int = 1 << 16):
+    flat = pixels.reshape(-1, 3).astype(np.float32)
+    pal = colors.astype(np.float32)
+    palNorm = np.sum(pal ** 2, 1)
+    out = np.empty(flat.shape[0], dtype=np.uint8)
+    for start in range(0, flat.shape[0], chunk):
+        dists = palNorm - 2 * (flat[start:start + chunk] @ pal.T)
+        out[start:start + chunk] = np.argmin(dists, 1)
+    return out.reshape(pixels.shape[:-1])
+
+
+# the best few of the DAC's colours for an image or a whole clip, as pixel bytes: k-means on the pixels, with every
+# centre moved to the closest colour the DAC has after each step so the result can be shown exactly.
+# entries is how many the packed format has room for (4 or 16). An image with fewer colours than that gets the
+# colours it has, repeated to fill up
+def choosePalette(colors: np.ndarray, imgs: np.ndarray, entries: int, iterations: int = 10, sample: int = 1 << 16):
+    import cv2 as cv
+    pixels = imgs.reshape(-1, 3).astype(np.float32)
+    if len(pixels) > sample:  # the palette of a long clip doesn't need every pixel
+        pixels = pixels[np.random.default_rng(0).choice(len(pixels), sample, replace=False)]
+    exact = np.unique(nearest(colors, pixels))
+    if len(exact) <= entries:
+        return np.resize(exact, entries).astype(np.uint8)
+
+    criteria = (cv.TERM_CRITERIA_EPS + cv.TERM_CRITERIA_MAX_ITER, 20, 1.0)
+    _, _, centers = cv.kmeans(pixels, entries, None, criteria, 3, cv.KMEANS_PP_CENTERS)
+    chosen = nearest(colors, centers)
+    for _ in range(iterations):
+        # two centres that landed on the same colour: the second takes the most common exact colour not yet used
+        for i in range(entries):
+            if chosen[i] in chosen[:i]:
+                spare = [c for c in exact if c not in chosen]
+                counts = np.bincount(nearest(colors, pixels), minlength=len(colors))
+                chosen[i] = max(spare, key=lambda c: counts[c])
+        owner = nearest(colors[chosen], pixels)
+        moved = chosen.copy()
+        for i in range(entries):
+            if np.any(owner == i):
+                moved[i] = nearest(colors, pixels[owner == i].mean(0)[np.newaxis])[0]
+        if np.array_equal(moved, chosen):
+            break
+        chosen = moved
+    return chosen.astype(np.uint8)
+
+
+# ordered dithering: nudge each pixel by a position-dependent fraction of the palette step before matching
+def quantizeOrdered(colors: np.ndarray, imgs: np.ndarray, step):
+    h, w = imgs.shape[-3:-1]
+    thresh = np.tile(bayer, (h // 4 + 1, w // 4 + 1))[:h, :w, np.newaxis]
+    return nearest(colors, np.clip(imgs + thresh * step, 0, 255))
+
+
+# Floyd-Steinberg error diffusion. The error has to be carried pixel by pixel,
+# so walk the image once and do every frame of the batch at the same time
+def quantizeFloyd(colors: np.ndarray, imgs: np.ndarray):
+    work = imgs.astype(np.float32).copy()
+    h, w = work.shape[-3:-1]
+    out = np.empty(work.shape[:-1], dtype=np.uint8)
+    for y in range(h):
+        for x in range(w):
+            old = np.clip(work[..., y, x, :], 0, 255)
+            idx = nearest(colors, old)
+            out[..., y, x] = idx
+            err = old - colors[idx]
+            if x + 1 < w:
+                work[..., y, x + 1, :] += err * (7 / 16)
+            if y + 1 < h:
+                if x > 0:
+                    work[..., y + 1, x - 1, :] += err * (3 / 16)
+                work[..., y + 1, x, :] += err * (5 / 16)
+                if x + 1 < w:
+                    work[..., y + 1, x + 1, :] += err * (1 / 16)
+    return out
+
+
+# quantize one (h, w, 3) image or a whole (n, h, w, 3) clip to palette indices
+# step is the gap between palette levels, for each channel if they differ (see paletteStep)
+def quantize(colors: np.ndarray, imgs: np.ndarray, method: str = 'nearest', step=85):
+    if method == 'floyd':
+        return quantizeFloyd(colors, imgs)
+    if method == 'ordered':
+        return quantizeOrdered(colors, imgs, step)
+    return nearest(colors, imgs)
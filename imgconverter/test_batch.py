@@ -0,0 +1,72 @@
+"""
+Checks the frame pacing and the clip conversion shared by batch.py and norpack.py, run with:
+    python -m unittest test_batch
+"""
+
+import os
+import tempfile
+import unittest
+from multiprocessing import Pool
+import cv2 as cv
+import batch
+
+SIZE = (80, 60)
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+class TicksTest(unittest.TestCase):
+    def testSlowerThanRefresh(self):
+        ticks = batch.toTicks([1 / 24] * 4)
+        self.assertEqual(sum(ticks), 10)
+        self.assertTrue(all(t in (2, 3) for t in ticks))
+
+    def testFasterThanRefreshDrops(self):
+        ticks = batch.toTicks([1 / 144] * 144)
+        self.assertEqual(sum(ticks), batch.REFRESH)
+        self.assertEqual(sum(1 for t in ticks if t), batch.REFRESH)
+        frames, kept = batch.collapse([bytes([i]) for i in range(144)], ticks)
+        self.assertEqual(len(frames), batch.REFRESH)
+        self.assertTrue(all(kept))
+
+    def testTooShortStillShown(self):
+        self.assertEqual(batch.toTicks([0.001, 0.001]), [0, 1])
+
+    def testCollapse(self):
+        frames, ticks = batch.collapse([b'a', b'b', b'a', b'a', b'c'], [2, 0, 1, 3, 1])
+        self.assertEqual(frames, [b'a', b'c'])
+        self.assertEqual(ticks, [6, 1])
+
+
+class ClipTest(unittest.TestCase):
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.cache = os.path.join(self.tmp.name, 'cache')
+        os.makedirs(self.cache)
+        self.clip = os.path.join(self.tmp.name, 'clip')
+        os.makedirs(self.clip)
+        for i, name in enumerate(['lenna.png', 'pylogo.png'] * 3):
+            cv.imwrite(os.path.join(self.clip, '{}.png'.format(i)), cv.imread(os.path.join(HERE, name)))
+
+    def tearDown(self):
+        self.tmp.cleanup()
+
+    def testChunksInOrder(self):
+        chunk = batch.CHUNK
+        batch.CHUNK = 4  # so the clip spans two chunks
+        try:
+            with Pool(2) as pool:
+                results = list(batch.convertClip(pool, self.clip, 30, SIZE, 'nearest', 'bgr222', self.cache))
+        finally:
+            batch.CHUNK = chunk
+        self.assertEqual(len(results), 6)
+        for i, (data, _, duration) in enumerate(results):
+            self.assertEqual(data, results[i % 2][0])
+            self.assertEqual(len(data), SIZE[0] * SIZE[1])
+            self.assertAlmostEqual(duration, 1 / 30)
+
+    def testUnreadableImage(self):
+        bad = os.path.join(self.clip, '9.png')
+        with open(bad, 'wb') as f:
+            f.write(b'not a png')
+        with self.assertRaisesRegex(IOError, '9.png'):
+            list(batch.readFrames(self.clip, 30))
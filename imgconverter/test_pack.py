@@ -0,0 +1,60 @@
+"""
+Checks that pack.py builds every kind of asset the firmware decodes, run with:
+    python -m unittest test_pack
+"""
+
+import os
+import struct
+import tempfile
+import unittest
+import cv2 as cv
+import numpy as np
+import pack
+import vq
+
+SIZE = (80, 60)
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+
+class PackTest(unittest.TestCase):
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.cache = os.path.join(self.tmp.name, 'cache')
+        os.makedirs(self.cache)
+        # a two frame clip, as a directory of images
+        self.clip = os.path.join(self.tmp.name, 'clip')
+        os.makedirs(self.clip)
+        cv.imwrite(os.path.join(self.clip, 'a.png'), cv.imread(os.path.join(HERE, 'lenna.png')))
+        cv.imwrite(os.path.join(self.clip, 'b.png'), cv.imread(os.path.join(HERE, 'pylogo.png')))
+
+    def tearDown(self):
+        self.tmp.cleanup()
+
+    def build(self, kind: str):
+        return pack.buildAsset(kind + ':' + self.clip, SIZE, 'nearest', 'bgr222', self.cache)
+
+    def testVqClip(self):
+        for block in (2, 4):
+            name, fmt, frames, data = self.build('vq{}'.format(block))
+            self.assertEqual(fmt, pack.FORMAT_VQ)
+            self.assertEqual(frames, 2)
+            width, height, codes = struct.unpack_from('<BBH', data)
+            self.assertEqual((width, height), (block, block))
+            # the length vqValid expects
+            blocks = (SIZE[0] // block) * (SIZE[1] // block)
+            self.assertEqual(len(data), 4 + codes * block * block + frames * blocks)
+            self.assertEqual(vq.decode(data, SIZE).shape, (2, SIZE[1], SIZE[0]))
+
+    def testPackedClip(self):
+        for entries, bits in ((4, 2), (16, 4)):
+            name, fmt, frames, data = self.build('pal{}'.format(entries))
+            self.assertEqual(fmt, pack.FORMAT_PACKED)
+            self.assertEqual(frames, 2)
+            self.assertEqual(len(data), pack.PACKED_HEADER.size + frames * SIZE[0] * SIZE[1] * bits // 8)
+            pixels = pack.unpackPixels(data, SIZE)
+            palette = np.frombuffer(data, np.uint8, 1 << bits, 4)
+            self.assertTrue(np.isin(pixels, palette).all())
+
+
+if __name__ == '__main__':
+    unittest.main()
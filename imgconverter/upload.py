@@ -0,0 +1,54 @@
+import argparse
+import time
+import serial
+
+SYNC = 0xA5
+PAGE_SIZE = 1024
+CHUNK = 64  # most data bytes the firmware takes in one write
+
+
+def send(port: serial.Serial, cmd: str, payload: bytes = b''):
+    body = bytes([ord(cmd), len(payload)]) + payload
+    check = 0
+    for b in body:
+        check ^= b
+    port.write(bytes([SYNC]) + body + bytes([check]))
+
+
+def command(port: serial.Serial, cmd: str, payload: bytes = b''):
+    send(port, cmd, payload)
+    reply = port.read(1)
+    if reply != b'K':
+        raise IOError('{} failed: {!r}'.format(cmd, reply))
+
+
+# erase and rewrite the asset region over the UART (see inc/flashwriter.h), while the board keeps displaying
+def main():
+    parser = argparse.ArgumentParser(description='Update the asset region of a running board')
+    parser.add_argument('port')
+    parser.add_argument('blob', nargs='?', default='assets.bin')
+    parser.add_argument('--baud', type=int, default=115200)
+    args = parser.parse_args()
+
+    with open(args.blob, 'rb') as f:
+        data = f.read()
+    data += bytes(-len(data) % 2)
+
+    # an erase can take a couple of frames, so be generous with the timeout
+    with serial.Serial(args.port, args.baud, timeout=1) as port:
+        start = time.perf_counter()
+        for page in range((len(data) + PAGE_SIZE - 1) // PAGE_SIZE):
+            command(port, 'E', bytes([page]))
+            for offset in range(page * PAGE_SIZE, min((page + 1) * PAGE_SIZE, len(data)), CHUNK):
+                command(port, 'W', offset.to_bytes(2, 'little') + data[offset:offset + CHUNK])
+            print('page {} done'.format(page))
+
+        send(port, 'S')
+        written, frames, rate = port.readline().decode().split()
+        command(port, 'D')
+        print('wrote {} bytes in {} frames ({} bytes/s on the board, {:.1f} s total)'.format(
+            written, frames, rate, time.perf_counter() - start))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,111 @@
+import argparse
+import struct
+import time
+import cv2 as cv
+import numpy as np
+import batch
+import quantize
+
+# must match vqHeader in inc/vq.h: block width, block height, dictionary entries
+HEADER = struct.Struct('<BBH')
+BLOCKS = (2, 4)
+
+# rough cycles to decode a block, counted from the instructions vqDecodeRows runs for one with the flash wait state
+# on every fetch. They still want checking against m0sim/bench.txt's vq-decode benchmarks on a build: a whole 2x2
+# frame doesn't fit in the vblank, which the 2x2 count has to agree with for the check in report to mean anything
+BLOCK_CYCLES = {2: 28, 4: 70}
+VBLANK_CYCLES = 29568  # from the vblank interrupt to the first visible line
+
+
+# cut (n, h, w, 3) frames into (n * h/b * w/b, b*b*3) vectors, a row of blocks at a time, each block row by row
+def toBlocks(imgs: np.ndarray, block: int):
+    n, h, w, c = imgs.shape
+    return imgs.reshape(n, h // block, block, w // block, block, c).transpose(0, 1, 3, 2, 4, 5).reshape(-1, block * block * c)
+
+
+# index of the closest entry for every vector, by the same expansion of the squared distance as quantize.nearest
+def closest(entries: np.ndarray, vectors: np.ndarray, chunk: int = 1 << 14):
+    entries = entries.astype(np.float32)
+    norms = np.sum(entries ** 2, 1)
+    out = np.empty(len(vectors), dtype=np.uint8)
+    for start in range(0, len(vectors), chunk):
+        out[start:start + chunk] = np.argmin(norms - 2 * (vectors[start:start + chunk] @ entries.T), 1)
+    return out
+
+
+# a dictionary of up to codes blocks shared by the whole clip, and every frame's blocks as indices into it.
+# k-means finds the blocks in full colour, then they're rounded to colours the DAC has and every block of the clip is
+# matched again against what the rounded ones will look like
+def encode(imgs: np.ndarray, block: int, codes: int, palette: str):
+    colors = quantize.genColorMap(palette)
+    vectors = toBlocks(imgs.astype(np.float32), block)
+    k = min(codes, len(np.unique(vectors, axis=0)))
+    criteria = (cv.TERM_CRITERIA_EPS + cv.TERM_CRITERIA_MAX_ITER, 30, 0.5)
+    _, _, centers = cv.kmeans(vectors, k, None, criteria, 3, cv.KMEANS_PP_CENTERS)
+    dictionary = quantize.nearest(colors, centers.reshape(k, block * block, 3))
+    indices = closest(colors[dictionary].reshape(k, -1), vectors)
+    return dictionary.astype(np.uint8), indices.reshape(len(imgs), -1)
+
+
+def pack(block: int, dictionary: np.ndarray, indices: np.ndarray):
+    return HEADER.pack(block, block, len(dictionary)) + dictionary.tobytes() + indices.tobytes()
+
+
+# palette indices for every frame of a packed clip, (frames, h, w)
+def decode(data: bytes, size):
+    width, height = size
+    block, _, codes = HEADER.unpack_from(data)
+    dictionary = np.frombuffer(data, np.uint8, codes * block * block, HEADER.size).reshape(codes, block, block)
+    indices = np.frombuffer(data, np.uint8, offset=HEADER.size + codes * block * block)
+    across, down = width // block, height // block
+    pixels = dictionary[indices.reshape(-1, down, across)]  # (frames, down, across, block, block)
+    return pixels.transpose(0, 1, 3, 2, 4).reshape(-1, height, width)
+
+
+def blockCycles(block: int, size):
+    return BLOCK_CYCLES[block] * (size[0] // block) * (size[1] // block)
+
+
+# compression against raw indexed frames, and decode cycles a frame, for pack.py and main below to print
+def report(data: bytes, frames: int, size):
+    block = data[0]
+    cycles = blockCycles(block, size)
+    fits = 'fits in the vblank' if cycles <= VBLANK_CYCLES else 'more than the vblank, so it is decoded behind the beam'
+    return '{:.1f}:1 against raw frames, about {} cycles to decode a frame ({})'.format(
+        frames * size[0] * size[1] / len(data), cycles, fits)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Try the VQ codec on a clip: its compression and how close it looks')
+    parser.add_argument('input', help='a video, GIF or directory of images')
+    parser.add_argument('--block', type=int, choices=BLOCKS, default=4)
+    parser.add_argument('--codes', type=int, default=256, help='dictionary entries, at most 256')
+    parser.add_argument('--size', default='80x60', help='frame geometry, WIDTHxHEIGHT')
+    parser.add_argument('--fps', type=float, default=batch.REFRESH,
+                        help='frame rate for image directories and inputs that don\'t report one')
+    parser.add_argument('--palette', choices=sorted(quantize.PALETTES), default='bgr222')
+    parser.add_argument('-o', '--output', help='write the packed clip here')
+    args = parser.parse_args()
+
+    size = tuple(int(v) for v in args.size.lower().split('x'))
+    start = time.perf_counter()
+    imgs = np.array([cv.resize(img, size, interpolation=cv.INTER_AREA) for img, _ in batch.readFrames(args.input, args.fps)])
+    dictionary, indices = encode(imgs, args.block, min(args.codes, 256), args.palette)
+    data = pack(args.block, dictionary, indices)
+    if args.output:
+        with open(args.output, 'wb') as outf:
+            outf.write(data)
+
+    # how far it is from each frame matched to the palette pixel by pixel, which is the best the DAC could do
+    colors = quantize.genColorMap(args.palette)
+    shown = colors[decode(data, size)]
+    best = colors[quantize.nearest(colors, imgs)]
+    mse = np.mean((shown - best) ** 2)
+    psnr = 10 * np.log10(255 ** 2 / mse) if mse else float('inf')
+    print('{} frames, {} codes of {}x{}: {} bytes, {}, {:.1f} dB from per pixel matching, in {:.3f} s'.format(
+        len(imgs), len(dictionary), args.block, args.block, len(data), report(data, len(imgs), size), psnr,
+        time.perf_counter() - start))
+
+
+if __name__ == '__main__':
+    main()
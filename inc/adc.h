@@ -0,0 +1,35 @@
+#ifndef ADC_H
+#define ADC_H
+
+#include <stdint.h>
+
+/*
+ * Analog inputs sampled once a frame, in the vblank, with no polling.
+ *
+ * TIM2's vblank compare (CC3, the one that fires the vblank interrupt) also goes out on its TRGO and starts an ADC scan
+ * of the chosen channels. DMA channel 1 moves the results into one half of a double buffer, and its transfer complete
+ * interrupt points it at the other half for the next frame and publishes the half that's done as adcLatest.
+ * With oversampling the scan repeats 1 << shift times back to back and the interrupt averages them in place.
+ * A set is never written again until two frames after it's published, so a copy made in the frame update is consistent.
+ */
+
+// bits for adcInit's channels: ADC_IN0..7 are PA0..7, 8 and 9 are PB0 and PB1, 10..15 are PC0..5.
+// The video uses PA1, PA2, PA7 and PB0..7 (and genlock PA0 and PA6, audio PA4), which leaves PA3, PA5 and PC1..5
+#define ADC_CHANNEL(n) (1UL << (n))
+#define ADC_TEMPERATURE ADC_CHANNEL(16) // the internal temperature sensor
+#define ADC_VREFINT ADC_CHANNEL(17)     // the internal 1.2 V reference, to work out the supply voltage
+
+#define ADC_JOYSTICK (ADC_CHANNEL(11) | ADC_CHANNEL(12)) // an analog stick's two pots on PC1 and PC2
+
+#define ADC_MAX_CHANNELS 6
+#define ADC_MAX_SHIFT 3 // up to 8 scans a frame
+
+// the newest complete set of readings (12 bit, averaged), one per channel in channel order, or 0 before the first one
+extern const uint16_t * volatile adcLatest;
+// frameCount when adcLatest was sampled
+extern volatile unsigned int adcFrame;
+
+void adcInit(uint32_t channels, uint8_t shift);
+int adcRead(int channel);
+
+#endif
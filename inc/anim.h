@@ -0,0 +1,40 @@
+#ifndef ANIM_H
+#define ANIM_H
+
+#include <stdint.h>
+
+/*
+ * Plays a sequence of colour assets from flash, each for its own number of frames. An indexed, VQ or packed asset with
+ * more than one frame is a clip, and each of its frames is shown for that long in turn.
+ *
+ * Every image is due on a frame counted from the start of the animation (frameCount, which the vblank interrupt
+ * ticks), so the pacing never drifts however late one of them is. An image is loaded during the frame before it's
+ * due and revealed in the vblank:
+ *   - a scan-out image needs no loading, the DMA is just pointed at it;
+ *   - an indexed image is copied into the screen buffer. If the buffer is on screen that's a row at a time as the beam
+ *     finishes with each one (see rowsDone), so the copy is spread over the frame and the vblank only has the last
+ *     row or two left; otherwise any time.
+ *   - a VQ image (see vq.h) is decoded into the screen buffer the same way, a row of blocks at a time, and a packed
+ *     one (see packed.h) a row at a time.
+ * An image that's revealed after its frame counts as late, and one whose time is already over before it could be
+ * shown is skipped and counted as dropped.
+ *
+ * Once the player has started it owns the screen until animStop, which leaves the last picture up.
+ */
+
+typedef struct {
+	uint16_t asset;  // an indexed, VQ, packed or scan-out asset, WIDTH x HEIGHT
+	uint16_t frames; // how long to show it (or each frame of a clip) for, in frames (60ths of a second)
+} animFrame;
+
+extern uint32_t animShown;   // images revealed
+extern uint32_t animLate;    // revealed after their frame
+extern uint32_t animDropped; // skipped because they'd have been too late
+
+int animStart(const animFrame *frames, int count, int loop);
+void animStop(void);
+int animActive(void);
+void animLine(void);
+void animUpdate(void);
+
+#endif
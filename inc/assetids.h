@@ -0,0 +1,11 @@
+// generated by imgconverter/pack.py, do not edit
+#ifndef ASSETIDS_H
+#define ASSETIDS_H
+
+#define ASSET_LENNA 0
+#define ASSET_PYLOGO 1
+#define ASSET_RICKSLIDE 2
+#define ASSET_LENNADITHER 3
+#define ASSET_LENNAMONO 4
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#include <stdint.h>
+#include "assetids.h"
+
+/*
+ * Images live in their own flash region (ASSETS in LinkerScript.ld) as raw bytes behind an index,
+ * so they can be rebuilt and reflashed without touching the firmware.
+ * The layout is written by imgconverter/pack.py and must stay in sync with it.
+ */
+
+#define ASSET_MAGIC 0x414d5453 // 'STMA'
+
+// width bytes per row, copied into the screen buffer
+#define ASSET_FORMAT_INDEXED 0
+// width bytes per row including the zero edge pixel, so the DMA can scan it out directly
+#define ASSET_FORMAT_SCANOUT 1
+// a bit per pixel for the mono video mode, MONO_STRIDE bytes per row including the zero edge byte
+#define ASSET_FORMAT_MONO 2
+// width bytes per row and twice the rows of the screen, for the field video mode
+#define ASSET_FORMAT_FIELDS 3
+// a clip of blocks out of a shared dictionary (see vq.h), decoded into the screen buffer
+#define ASSET_FORMAT_VQ 4
+// 2 or 4 bits a pixel indexing a palette stored with it (see packed.h), decoded into the screen buffer
+#define ASSET_FORMAT_PACKED 5
+
+typedef struct {
+	uint16_t id;
+	uint16_t width;
+	uint16_t height;
+	uint16_t frames;  // 1 for still images
+	uint8_t format;
+	uint8_t palette;  // the PALETTE_* (see vga.h) the pixels were converted for
+	uint8_t reserved[2];
+	uint32_t offset;  // from the start of the asset region
+	uint32_t length;  // in bytes, the data is padded to a whole word after this
+	uint32_t crc;     // CRC-32 of the padded data, as the CRC peripheral computes it
+} assetEntry;
+
+typedef struct {
+	uint32_t magic;
+	uint32_t count;
+	assetEntry entries[];
+} assetIndex;
+
+const assetEntry *assetFind(uint16_t id);
+const assetEntry *assetAt(uint32_t i);
+const char *assetData(const assetEntry *asset);
+int assetInRegion(const assetEntry *asset);
+int assetValid(const assetEntry *asset);
+int assetCheck(const assetEntry *asset);
+
+#endif
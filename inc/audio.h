@@ -0,0 +1,31 @@
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include <stdint.h>
+
+/*
+ * Sound out of the DAC on PA4, one sample per line (about 37.9 kHz) with no timer or interrupt of its own.
+ *
+ * TIM3's update event at the start of every line makes DMA channel 3 move the next byte of a ring buffer into the DAC,
+ * which converts it straight away. That's in the horizontal blanking, so it never holds up the pixel DMA.
+ * Once a frame the main loop calls audioFill, which mixes the playing voices into the part of the ring the DMA has
+ * already sent. If it isn't called for longer than the ring lasts (a flash page erase), the ring plays again.
+ */
+
+#define AUDIO_RATE (40000000 / 1056) // samples per second, the line rate
+#define AUDIO_RING 768 // bytes of ring, a frame of samples (628) and some slack for a late fill
+#define AUDIO_VOICES 4
+
+// wavetables for audioTone, 64 signed samples of one period
+#define AUDIO_TABLE_LENGTH 64
+extern const int8_t audioSine[AUDIO_TABLE_LENGTH];
+extern const int8_t audioSquare[AUDIO_TABLE_LENGTH];
+
+void audioInit(void);
+void audioPlay(int voice, const int8_t *samples, uint32_t length, uint32_t step, uint8_t volume, uint8_t loop);
+void audioTone(int voice, const int8_t *table, uint32_t frequency, uint8_t volume, uint32_t ms);
+void audioStop(int voice);
+int audioPlaying(int voice);
+void audioFill(void);
+
+#endif
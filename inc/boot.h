@@ -0,0 +1,28 @@
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <stdint.h>
+
+/*
+ * How long the board takes from a reset to putting out sync, which is how long a monitor shows nothing after a
+ * power cycle (along with its own time to lock on).
+ *
+ * SysTick counts down from its top at the core clock from the first instruction of Reset_Handler: at the 8 MHz HSI
+ * until SystemInit switches to the PLL (bootClockSwitch), and at 40 MHz after that. The power-on reset delay, while
+ * the supply comes up, is before any code runs so it isn't counted.
+ * The picture comes later than the sync: nothing is scanned out until showAsset first points the DMA at an asset, and
+ * then not in full until the next frame starts (bootPictureReady).
+ */
+
+#define BOOT_SYSTICK_TOP 0xFFFFFF // SysTick is 24 bits, which lasts 0.4 s at 40 MHz
+
+extern uint32_t bootHsiTicks;
+extern uint32_t bootSyncUs;
+extern uint32_t bootPictureUs;
+
+void bootClockSwitch(void);
+void bootSyncStarted(void);
+void bootPictureReady(void);
+void bootReport(void);
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef DRAW_H
+#define DRAW_H
+
+#include <stdint.h>
+
+/*
+ * Drawing commands sent over the UART, so a host can build up a picture without sending its pixels.
+ *
+ * They come in the flash writer's packets (see flashwriter.h), 0xA5, command, payload length, payload, xor:
+ *     'X' color                    clear the screen
+ *     'R' x y w h color            fill a rectangle
+ *     'T' x y color text...        draw text in a 3x5 font on a 4x6 grid, up to 61 characters
+ *     'B' id x y                   copy an indexed asset's pixels to x, y
+ *     'Q'                          print "queued frame total late dropped": bytes waiting, commands run in the last
+ *                                  frame update and since startup, updates that ran out of vblank, packets refused
+ * Coordinates are in screen pixels, and everything is clipped to the screen. The first command takes the screen
+ * buffer over from the asset being shown, keeping its picture if it's a colour one.
+ *
+ * Commands go into a queue and are run in the vblank, as many as fit before the first visible line, so nothing
+ * tears. They aren't answered unless they're refused ('N', for a bad one or a full queue). Instead the board sends
+ * XOFF when the queue is nearly full and XON once it has room again, so open the port with software flow control.
+ */
+
+#define DRAW_QUEUE 256 // bytes of queued commands
+#define DRAW_ENTRY_MAX (2 + 66) // command, length and the biggest payload a packet carries
+#define DRAW_XON 0x11
+#define DRAW_XOFF 0x13
+
+extern uint32_t drawCommands;
+extern uint16_t drawFrameCommands;
+extern uint32_t drawLateFrames;
+extern uint32_t drawDropped;
+
+int drawQueue(uint8_t cmd, const uint8_t *payload, uint8_t len);
+int drawPending(void);
+void drawRun(void);
+
+#endif
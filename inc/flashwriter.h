@@ -0,0 +1,22 @@
+#ifndef FLASHWRITER_H
+#define FLASHWRITER_H
+
+/*
+ * Rewrites the ASSETS flash region over the UART while the video keeps running.
+ *
+ * Packets are 0xA5, command, payload length, payload, then the xor of everything after the 0xA5.
+ * Commands (each answered with 'K' once done, or 'N' if rejected):
+ *     'E' page             erase a 1K page of the asset region
+ *     'W' offset(2) data   program data (an even number of bytes, at most 64) at a byte offset into the region
+ *     'S'                  print "bytes frames bytes/s" for the update so far
+ *     'D'                  the update is finished, go back to showing assets
+ * Only one erase or write can be outstanding, so the host has to wait for the answer before sending the next one.
+ * The same packets also carry the drawing commands (see draw.h), and bytes outside a packet go to the shell (shell.h).
+ */
+
+void relocateVectors(void);
+int flashWriterPoll(void);
+int flashWriterActive(void);
+void flashWriterRun(void);
+
+#endif
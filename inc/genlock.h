@@ -0,0 +1,41 @@
+#ifndef GENLOCK_H
+#define GENLOCK_H
+
+#include <stdint.h>
+
+/*
+ * Locks the line and frame timing to an external sync source, so several boards can drive a video wall in step.
+ *
+ * The source has to have this board's timing (800x600 60 Hz at a 40 MHz pixel clock), but its clock doesn't have to
+ * match: each board runs off its own HSI, which can be a percent out. TIM3 is reset by every hsync edge and TIM2 by every
+ * vsync edge, and both capture the count they were at when it came, which is the phase error that reset took out.
+ * Once a frame (genlockUpdate) the errors are checked, and after GENLOCK_SETTLE_FRAMES good frames it counts as locked.
+ */
+
+// sync inputs: hsync on PA6 (TIM3_CH1) and vsync on PA0 (TIM2_CH1), from another board's PA7 and PA1 or any 800x600 60 Hz source
+// flags for genlockStart. By default the timing locks to the rising edges, which is where this board's own sync pulses start
+#define GENLOCK_HSYNC_FALLING 0x1
+#define GENLOCK_VSYNC_FALLING 0x2
+
+// genlockState
+#define GENLOCK_OFF 0       // free running
+#define GENLOCK_SEARCHING 1 // following the inputs, but the phase error is too big or a sync is missing
+#define GENLOCK_LOCKED 2
+
+#define GENLOCK_SLACK 64 // cycles a line can run past LINE_CYCLES waiting for the hsync before TIM3 wraps on its own
+#define GENLOCK_TOLERANCE 24 // phase error in cycles that still counts as locked, about 2% of a line
+#define GENLOCK_SETTLE_FRAMES 2 // frames in a row within tolerance before it's locked
+
+extern volatile uint8_t genlockState;
+extern volatile int syncLine;
+extern volatile uint32_t syncVsyncs;
+extern volatile uint32_t genlockCapture;
+extern int32_t genlockLineError;
+extern int32_t genlockFrameError;
+extern uint32_t genlockLockFrames;
+
+void genlockStart(uint8_t flags);
+void genlockStop(void);
+uint8_t genlockUpdate(void);
+
+#endif
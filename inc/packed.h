@@ -0,0 +1,26 @@
+#ifndef PACKED_H
+#define PACKED_H
+
+#include <stdint.h>
+#include "assets.h"
+
+/*
+ * Packed colour images and clips (ASSET_FORMAT_PACKED, made by imgconverter/pack.py's pal4: and pal16: kinds).
+ *
+ * Each pixel is 2 or 4 bits indexing a palette of 4 or 16 of the DAC's colours, picked for that image or clip (see
+ * choosePalette in imgconverter/quantize.py), so a frame is 1200 or 2400 bytes instead of 4800. Pictures with few
+ * colours, or clips of them, barely look any different. Decoding is a palette lookup per pixel into the screen buffer,
+ * any rows at a time so it can go behind the beam (see anim.h).
+ */
+
+typedef struct {
+	uint8_t bits;         // per pixel, 2 or 4
+	uint8_t reserved[3];
+	uint8_t palette[16];  // the pixel byte for each index, only the first 4 used with 2 bits
+} packedHeader;           // then the frames, WIDTH * bits / 8 bytes a row, the first pixel of each byte in its high bits
+
+int packedValid(const assetEntry *asset);
+const uint8_t *packedFrame(const assetEntry *asset, int frame);
+int packedDecodeRows(const packedHeader *packed, const uint8_t *pixels, int row, int last);
+
+#endif
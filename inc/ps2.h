@@ -0,0 +1,34 @@
+#ifndef PS2_H
+#define PS2_H
+
+#include <stdint.h>
+
+/*
+ * A PS/2 keyboard on PB8 (clock) and PB9 (data), both 5 V tolerant, so they can go straight to the socket with the
+ * keyboard's own pull-ups (or 5k to 5 V).
+ *
+ * TIM16 captures every falling edge of the clock through its input filter and interrupts, and the interrupt reads the
+ * data bit (which is steady while the clock is low). That's 11 short interrupts per scancode at the lowest priority,
+ * about 1 every 80 us, and they never hold the line interrupt off since it can preempt them. The interrupt runs from
+ * RAM, so it keeps taking bits while a flash page is being erased; from flash its first fetch would stall the bus, and
+ * the line interrupt with it, until the erase was done. The capture times frame the bits: a gap longer than any bit
+ * means the next edge is a start bit, so a frame that's cut short (by noise or a hot plug) only loses itself. Complete
+ * scancodes with a good parity go into a ring, and ps2Update decodes them into characters in the main loop, after the
+ * frame update.
+ */
+
+#define PS2_GAP_US 200 // longer than a bit at the slowest clock a keyboard may use (10 kHz)
+
+// keys that aren't characters, from ps2ReadKey
+#define PS2_KEY_BACKSPACE 0x08
+#define PS2_KEY_TAB '\t'
+#define PS2_KEY_ENTER '\n'
+#define PS2_KEY_ESCAPE 0x1b
+
+extern volatile uint32_t ps2Errors; // frames dropped for a bad start, stop or parity bit, or a full ring
+
+void ps2Init(void);
+void ps2Update(void);
+int ps2ReadKey(void);
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef RAM_H
+#define RAM_H
+
+#include <stdint.h>
+
+/*
+ * How much of the 8K of RAM is really in use, at run time.
+ *
+ * Everything from the end of the heap up to the stack is painted with RAM_PAINT early in main, so the deepest the
+ * stack (including the interrupts stacked on top of it) has ever gone is the lowest word that isn't the pattern any
+ * more. _sbrk (syscalls.c) counts what it has handed out. m0sim/rammap.py gives the static side from the ELF.
+ */
+
+#define RAM_PAINT 0xA5A5A5A5
+
+extern uint32_t heapUsed;   // bytes the heap has grown to
+extern uint32_t heapPeak;   // the most it has ever been
+extern uint32_t heapFailed; // allocations refused because they'd have run into the stack
+
+void ramPaintStack(void);
+uint32_t ramStackUsed(void);
+uint32_t ramHeadroom(void);
+void ramReport(void);
+
+#endif
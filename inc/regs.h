@@ -0,0 +1,68 @@
+#ifndef REGS_H
+#define REGS_H
+
+#include "stm32f0xx.h"
+
+/*
+ * Register access for the video core (vga.c).
+ * On the target these are plain accesses through the CMSIS device macros, so they compile to exactly the same code
+ * as writing TIM3->SR &= ~TIM_SR_CC3IF directly.
+ * Building with HOST defined points the peripherals at ordinary structs instead and records every write,
+ * so the timer setup and the interrupt handlers can be run and checked on a PC.
+ */
+
+#ifndef HOST
+
+#define REG_WRITE(reg, value) ((reg) = (value))
+#define REG_SET(reg, bits) ((reg) |= (bits))
+#define REG_CLEAR(reg, bits) ((reg) &= ~(bits))
+#define REG_IRQ_ENABLE(irq, priority) do { NVIC->ISER[0] |= 1 << (irq); NVIC_SetPriority((irq), (priority)); } while(0)
+
+#else
+
+// a register write, and the value the register held afterwards
+typedef struct {
+	const volatile void *reg;
+	uint32_t value;
+} regWrite;
+
+#define REG_LOG_SIZE 4096
+extern regWrite regLog[REG_LOG_SIZE];
+extern int regLogCount;
+extern uint32_t irqEnabled;
+extern uint8_t irqPriority[32];
+
+void regRecord(const volatile void *reg, uint32_t value);
+void regReset(void);
+
+#define REG_WRITE(reg, value) ((reg) = (value), regRecord(&(reg), (reg)))
+#define REG_SET(reg, bits) ((reg) |= (bits), regRecord(&(reg), (reg)))
+#define REG_CLEAR(reg, bits) ((reg) &= ~(bits), regRecord(&(reg), (reg)))
+#define REG_IRQ_ENABLE(irq, priority) (irqEnabled |= 1 << (irq), irqPriority[irq] = (priority))
+
+// the peripherals the video core uses, as ordinary memory
+extern GPIO_TypeDef hostGPIOA, hostGPIOB, hostGPIOC;
+extern TIM_TypeDef hostTIM2, hostTIM3, hostTIM15;
+extern DMA_Channel_TypeDef hostDMA1_Channel5;
+extern SPI_TypeDef hostSPI1;
+
+#undef GPIOA
+#undef GPIOB
+#undef GPIOC
+#undef TIM2
+#undef TIM3
+#undef TIM15
+#undef DMA1_Channel5
+#undef SPI1
+#define GPIOA (&hostGPIOA)
+#define GPIOB (&hostGPIOB)
+#define GPIOC (&hostGPIOC)
+#define TIM2 (&hostTIM2)
+#define TIM3 (&hostTIM3)
+#define TIM15 (&hostTIM15)
+#define DMA1_Channel5 (&hostDMA1_Channel5)
+#define SPI1 (&hostSPI1)
+
+#endif
+
+#endif
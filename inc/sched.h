@@ -0,0 +1,50 @@
+#ifndef SCHED_H
+#define SCHED_H
+
+#include <stdint.h>
+#include "vga.h"
+
+/*
+ * A cooperative scheduler for the application's work, which knows where the beam is.
+ *
+ * Tasks are plain functions that do a bit of work and return. schedRun is called every time the main loop wakes (at
+ * least once a line), after the video's own work, and runs the tasks that are due and fit where the beam is:
+ *   - a task that doesn't touch the screen buffer (no band) can run anywhere;
+ *   - a task that draws to a band of visible lines only runs while the beam is outside the band, and only if it's
+ *     expected to finish before the beam comes round to the band's first pixel again, so it never tears. The whole
+ *     screen (SCHED_SCREEN) makes it a vblank task.
+ * No task starts if it might still be running at the end of the visible region, when the frame update is due.
+ * Whether a task fits is decided by its cost, the most cycles it's expected to take, so a task that now and then
+ * takes far longer (to print something, say) isn't shut out for good; it's counted late if that makes it overrun.
+ *
+ * The beam position is TIM2's count, which counts every cycle of the frame, and it also times the tasks: each one has
+ * the cycles it took this frame and the last, its longest run, and how often it finished after its deadline (late).
+ * The times include any interrupts that came in meanwhile, so they're what the task really cost the main loop.
+ */
+
+#define SCHED_SCREEN 0, VISIBLE_LINES // the band of a task drawing anywhere on the screen
+#define SCHED_LINES_PER_ROW (VISIBLE_LINES / HEIGHT) // visible lines per row of the colour mode, for bands
+
+typedef struct {
+	const char *name;
+	void (*run)(void);
+	uint8_t period;     // frames between runs, or 0 to run every time the main loop wakes up
+	uint16_t top;       // the visible lines the task draws to, top included and bottom not
+	uint16_t bottom;    // (both 0 if it doesn't draw)
+	uint32_t cost;      // the most cycles a run is expected to take
+
+	// kept by the scheduler
+	unsigned int lastFrame; // frameCount when it last ran
+	uint32_t cycles;        // taken in this frame so far
+	uint32_t lastCycles;    // taken in the last frame
+	uint32_t maxRun;        // the longest run
+	uint32_t runs;
+	uint32_t late;          // runs that finished past their deadline, the frame update or the beam reaching the band
+} schedTask;
+
+void schedInit(schedTask *tasks, int count);
+void schedRun(void);
+uint32_t schedCyclesLeft(void);
+void schedReport(void);
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef SHELL_H
+#define SHELL_H
+
+#include <stdint.h>
+
+/*
+ * A line-oriented shell on the UART, for looking at and changing a running board from a terminal.
+ *
+ * It shares the link with the flash writer: bytes outside the flash writer's packets (see flashwriter.h) are
+ * collected into a line, and the line is run by shellRun from the scheduler, never from the video's own work.
+ * A line is a command and its arguments separated by spaces, ended by CR or LF. Replies are one or more lines,
+ * and errors start with '?'. 'help' lists the commands; the rest are a table the application passes to shellInit.
+ *
+ * Replies never hold up the main loop: a line is only run once the UART's ring has SHELL_REPLY bytes free, so a
+ * command's reply fits as long as it's no longer than that, and help's list goes out a command at a time as the
+ * ring has room for it. A longer reply still gets through, it just waits on the UART for the rest.
+ */
+
+#define SHELL_LINE 40 // longest line, longer ones are refused
+#define SHELL_REPLY 240 // room a command gets in the UART's ring, so its reply goes out without waiting on the line
+
+typedef struct {
+	const char *name;
+	const char *help;
+	void (*run)(const char *args); // the rest of the line, from the first non-space after the name
+} shellCommand;
+
+void shellInit(const shellCommand *commands, int count);
+void shellInput(char c);
+void shellRun(void);
+int shellNumber(const char **args, uint32_t *n);
+int shellWord(const char **args, const char *word);
+
+#endif
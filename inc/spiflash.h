@@ -0,0 +1,32 @@
+#ifndef SPIFLASH_H
+#define SPIFLASH_H
+
+#include <stdint.h>
+
+/*
+ * An external SPI NOR flash (any 25-series part: W25Q, MX25L, IS25LP...) on SPI2, read only.
+ *
+ * Wiring: PB12 to CS, PB13 to CLK, PB14 to DO, PB15 to DI, with the part's WP and HOLD pins pulled high.
+ * Only the commands every part has are used: read JEDEC ID (0x9F), release from power-down (0xAB) and read (0x03),
+ * at 20 MHz, which all of them manage for plain reads. It's written on a PC with a programmer (imgconverter/norpack.py
+ * makes the image), and m0sim/spinor.py stands in for it off the board.
+ *
+ * spiFlashRead is polled, for headers and the like. spiFlashStart sends the read command and lets DMA channel 4 bring
+ * the data in with SPI2 in receive-only mode, so the clock keeps running without anything to send. Channel 4 is at
+ * the lowest priority and the pixels' channel 5 at the highest, so the DMA arbiter serves the pixel first when both
+ * request together. That's the arbiter's rule from the reference manual, not a measurement: a channel 4 transfer
+ * already under way still finishes first, which could hold a pixel up by a bus cycle or two. It hasn't been checked on
+ * a scope for jitter on the pixel edges while a read is going.
+ * The transfer-complete interrupt stops the clock and raises CS; the few bytes clocked in after the end are dropped.
+ */
+
+#define SPIFLASH_CMD_READ 0x03
+#define SPIFLASH_CMD_RELEASE 0xAB
+#define SPIFLASH_CMD_JEDEC_ID 0x9F
+
+uint32_t spiFlashInit(void);
+void spiFlashRead(uint32_t addr, void *buf, uint32_t len);
+int spiFlashStart(uint32_t addr, void *buf, uint16_t len);
+int spiFlashBusy(void);
+
+#endif
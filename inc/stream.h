@@ -0,0 +1,42 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stdint.h>
+
+/*
+ * Plays a video from the external SPI NOR flash (see spiflash.h) at up to 60 frames a second.
+ *
+ * The image (imgconverter/norpack.py) is a header, the number of frames each video frame is shown for, then the
+ * frames, each in the scan-out layout (WIDTH + 1 bytes a row, ending in the zero edge pixel) so they can go straight
+ * into the screen buffer: 4860 bytes, about 3400 frames in 16 MB, or a minute at 60 and two at 30.
+ *
+ * It's paced like an animation (see anim.h): each frame is due on a frame counted from the start, and is read in
+ * during the frame before. There's only the one screen buffer, so the DMA brings in each row as soon as the beam has
+ * finished with it, a run of rows at a time, and the vblank only has the last one left. That's 4860 bytes at 20 MHz,
+ * 2 ms of a 16.7 ms frame. Frames revealed after their time are counted late, and ones skipped to catch up dropped.
+ */
+
+#define STREAM_MAGIC 0x564d5453 // 'STMV'
+#define STREAM_FORMAT_RAW 0 // frames in the scan-out layout
+
+typedef struct {
+	uint32_t magic;
+	uint32_t frames;
+	uint16_t frameSize;  // bytes per frame
+	uint8_t palette;     // the PALETTE_* (see vga.h) the pixels were converted for
+	uint8_t format;
+	uint32_t dataOffset; // where the frames start, the durations (a uint16_t per frame) are right after the header
+} streamHeader;
+
+extern uint32_t streamShown;
+extern uint32_t streamLate;
+extern uint32_t streamDropped;
+
+uint32_t streamOpen(uint32_t addr);
+int streamStart(int loop);
+void streamStop(void);
+int streamActive(void);
+void streamLine(void);
+void streamUpdate(void);
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef UART_H
+#define UART_H
+
+#include <stdint.h>
+
+// USART1 on PA9 (TX) and PA10 (RX), 115200 8N1
+// Everything sent goes through a ring that DMA channel 2 empties in the background, so writing never waits on the
+// line unless uartWrite finds the ring full. stdout (printf and friends) goes to uartSend, which never waits
+#define UART_BAUD 115200
+
+extern volatile uint32_t uartDropped; // bytes that didn't fit in the ring
+
+void uartInit(void);
+int uartRead(void);
+void uartWrite(char c);
+int uartSend(const char *data, int len);
+int uartRoom(void);
+void uartPrint(const char *s);
+void uartPrintNum(uint32_t n);
+void uartPrintInt(int32_t n);
+
+#endif
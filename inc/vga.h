@@ -0,0 +1,67 @@
+#ifndef VGA_H
+#define VGA_H
+
+#include <stdint.h>
+
+#define WIDTH 80
+#define HEIGHT 60
+
+// how the pixel byte is wired to the resistor DAC on GPIOB (see the README), which decides the assets that can be shown
+#define PALETTE_BGR222 0 // 64 colors: red on PB0..1, green on PB2..3, blue on PB4..5
+#define PALETTE_RGB332 1 // 256 colors: blue on PB0..1, green on PB2..4, red on PB5..7
+#ifndef PALETTE
+#define PALETTE PALETTE_BGR222
+#endif
+
+// timings in pixel clocks (the 40 MHz system clock), see setupHorizontalTimers and setupVerticalTimer
+#define LINE_CYCLES 1056
+#define FRAME_LINES 628
+#define VISIBLE_START (27 * LINE_CYCLES) // TIM2 count where the first visible line starts
+#define VISIBLE_END (627 * LINE_CYCLES)  // TIM2 count where the visible region ends and the vblank interrupt fires
+#define VISIBLE_LINES 600
+#define PIXEL_START (216 - 7) // TIM3 count that starts TIM15 and the pixels (216, less a fudge factor for the trigger delay)
+#define LINE_ISR_AT (1016 - 32) // TIM3 count that fires the line interrupt, a little before the pixels end
+
+// video modes, see setVideoMode
+#define VIDEO_COLOR 0 // WIDTH x HEIGHT, a byte per pixel on GPIOB
+#define VIDEO_MONO 1  // MONO_WIDTH x MONO_HEIGHT, a bit per pixel on SPI1 MOSI (PB5)
+#define VIDEO_FIELDS 2 // WIDTH x 2 * HEIGHT in colour, alternate rows shown in alternate frames
+
+#define MONO_WIDTH 400
+#define MONO_HEIGHT 100
+#define MONO_STRIDE (MONO_WIDTH / 8 + 1) // bytes per row, including a zero edge byte
+
+/*
+ * Anything the video has to keep running while flash is busy being erased or programmed has to live in RAM,
+ * because any fetch from flash stalls until the operation is done (up to 40 ms for a page erase).
+ * long_call lets code in flash reach it, since RAM is out of range of a normal bl.
+ */
+#ifndef HOST
+#define RAMFUNC __attribute__((section(".RamFunc"), long_call, noinline))
+#else
+#define RAMFUNC
+#endif
+
+// the framebuffer, in the layout of either mode. Each row ends in a zero edge pixel (or byte) so the DAC goes black
+typedef union {
+	char color[HEIGHT][WIDTH + 1];
+	uint8_t mono[MONO_HEIGHT][MONO_STRIDE];
+} screenBuffer;
+
+extern screenBuffer screen;
+extern const char *volatile frame;
+extern const char *volatile ditherFrames[2];
+extern volatile unsigned int frameCount;
+extern char lendflag;
+extern volatile uint8_t videoMode;
+extern volatile uint16_t lineLatencyMin;
+extern volatile uint16_t lineLatencyMax;
+
+void setupHorizontalTimers(void);
+void setupVerticalTimer(void);
+void setVideoMode(uint8_t mode);
+int fieldSlotsDone(void);
+int rowsDone(void);
+uint32_t vblankCyclesLeft(void);
+
+#endif
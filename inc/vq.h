@@ -0,0 +1,30 @@
+#ifndef VQ_H
+#define VQ_H
+
+#include <stdint.h>
+#include "assets.h"
+
+/*
+ * Vector quantised clips (ASSET_FORMAT_VQ, made by imgconverter/vq.py through pack.py's vq2: and vq4: kinds).
+ *
+ * Every frame is cut into blocks of 2x2 or 4x4 pixels, and each block is stored as a byte indexing a dictionary of up
+ * to 256 blocks that the whole clip shares. A 4x4 frame is 300 bytes instead of 4800 (a 2x2 one 1200), plus the
+ * dictionary once, so the 32K asset region holds around 90 frames instead of 6.
+ * Decoding is a lookup and a copy per block, a word at a time out of the dictionary, about as fast as copying an
+ * indexed image. It's done a row of blocks at a time so it can go behind the beam (see anim.h).
+ */
+
+typedef struct {
+	uint8_t blockWidth;   // 2 or 4
+	uint8_t blockHeight;  // the same
+	uint16_t codes;       // dictionary entries
+	// blockWidth * blockHeight pixels an entry, row by row: a word for 2x2 and a word a row for 4x4. Then the block
+	// indices, (WIDTH / blockWidth) * (HEIGHT / blockHeight) bytes a frame, a row of blocks at a time
+	uint32_t dictionary[];
+} vqHeader;
+
+int vqValid(const assetEntry *asset);
+const uint8_t *vqFrame(const assetEntry *asset, int frame);
+int vqDecodeRows(const vqHeader *vq, const uint8_t *indices, int row, int last);
+
+#endif
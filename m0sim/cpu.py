@@ -0,0 +1,588 @@
+MASK = 0xFFFFFFFF
+
+FLASH_BASE = 0x08000000
+FLASH_SIZE = 64 * 1024
+RAM_BASE = 0x20000000
+RAM_SIZE = 8 * 1024
+PERIPH_BASE = 0x40000000
+PERIPH_END = 0x48002000
+SCS_BASE = 0xE0000000
+
+# returning to this address ends a call (it's not a valid Thumb address, so nothing in the firmware can branch there)
+RETURN_MAGIC = 0xFFFFFFFE
+
+
+def signed(x: int):
+    return x - (1 << 32) if x & 0x80000000 else x
+
+
+def signExtend(x: int, bits: int):
+    sign = 1 << (bits - 1)
+    return ((x & (sign - 1)) - (x & sign)) & MASK
+
+
+def addWithCarry(x: int, y: int, carry: int):
+    total = x + y + carry
+    result = total & MASK
+    overflow = signed(result) != signed(x) + signed(y) + carry
+    return result, total >> 32, overflow
+
+
+# one word through the CRC unit with its reset settings (poly 0x04C11DB7, msb first, no reflection)
+def crcWord(crc: int, word: int):
+    crc ^= word
+    for _ in range(32):
+        crc = ((crc << 1) ^ 0x04C11DB7) if crc & 0x80000000 else crc << 1
+    return crc & MASK
+
+
+class SimError(Exception):
+    pass
+
+
+class Peripherals:
+    """
+    Stand-ins for the memory-mapped peripherals: plain registers that remember what was written,
+    except for timer counters (which count at the core clock while CR1.CEN is set, as they do in this firmware) and
+    CC1 captures (reading CCR1 clears CC1IF, as on the chip; m0sim/genlock.py does the capturing),
+    the CRC unit (so assetCheck passes on good data) and a few status bits that are forced or cleared so polling loops
+    finish (UART TXE, flash never busy, ADC ready and its calibrate and stop commands done at once).
+    Anything more (m0sim/spinor.py's SPI flash) hooks the registers it stands behind: a read hook gives the value read,
+    and a write hook sees the value after it's been stored.
+    """
+
+    TIMERS = {0x40000000: 'TIM2', 0x40000400: 'TIM3', 0x40014000: 'TIM15'}
+    CRC_DR = 0x40023000
+    CRC_CR = 0x40023008
+    ADC_CR = 0x40012408
+
+    def __init__(self, cpu):
+        self.cpu = cpu
+        self.regs = {}
+        self.counterBase = {}  # timer -> (count, cycle it was set at)
+        self.forced = {
+            0x4001381C: 0x000000C0,  # USART1 ISR: TXE and TC
+            0x4002200C: 0,  # FLASH SR: never busy
+            0x40012400: 0x00000001,  # ADC ISR: ADRDY
+        }
+        self.regs[self.CRC_DR] = MASK
+        self.readHooks = {}
+        self.writeHooks = {}
+
+    def timer(self, addr: int):
+        base = addr & ~0x3FF
+        return base if base in self.TIMERS and addr - base == 0x24 else None
+
+    def read(self, addr: int):
+        word = addr & ~3
+        base = self.timer(word)
+        if base is not None:
+            count, since = self.counterBase.get(base, (self.regs.get(word, 0), self.cpu.cycles))
+            if self.regs.get(base, 0) & 1:  # CR1.CEN
+                period = self.regs.get(base + 0x2C, MASK) + 1
+                return (count + self.cpu.cycles - since) % period
+            return count
+        if word in self.readHooks:
+            return self.readHooks[word]()
+        if word in self.forced:
+            return self.forced[word]
+        timer = word & ~0x3FF
+        if timer in self.TIMERS and word - timer == 0x34 and self.regs.get(timer + 0x18, 0) & 3:  # CCR1 of an input
+            self.regs[timer + 0x10] = self.regs.get(timer + 0x10, 0) & ~2
+        return self.regs.get(word, 0)
+
+    def write(self, addr: int, value: int):
+        word = addr & ~3
+        if word == self.CRC_DR:
+            self.regs[word] = crcWord(self.regs[word], value)
+            return
+        if word == self.CRC_CR and value & 1:  # RESET
+            self.regs[self.CRC_DR] = MASK
+            value &= ~1
+        if word == self.ADC_CR:
+            if value & 0x10:  # ADSTP stops a conversion (ADSTART) straight away
+                value &= ~0x14
+            value &= ~0x80000000  # ADCAL
+        base = self.timer(word)
+        if base is not None:
+            self.counterBase[base] = (value, self.cpu.cycles)
+        elif (word & ~0x3FF) in self.TIMERS and word & 0x3FF == 0:  # CR1: freeze or restart the counter
+            timer = word & ~0x3FF
+            self.counterBase[timer] = (self.read(timer + 0x24), self.cpu.cycles)
+        self.regs[word] = value
+        if word in self.writeHooks:
+            self.writeHooks[word](value)
+
+
+class Memory:
+    """
+    Flash (also aliased at 0, or RAM if SYSCFG has remapped it), RAM, peripherals and the system control space.
+    Every access returns the extra wait cycles it cost on top of the instruction timing.
+    """
+
+    def __init__(self, cpu, flashWait: int, periphWait: int):
+        self.flash = bytearray(b'\xff' * FLASH_SIZE)
+        self.ram = bytearray(RAM_SIZE)
+        self.periph = Peripherals(cpu)
+        self.scs = {}
+        self.flashWait = flashWait
+        self.periphWait = periphWait
+
+    def region(self, addr: int):
+        if addr < FLASH_SIZE:
+            if self.periph.read(0x40010000) & 3 == 3:  # SYSCFG CFGR1.MEM_MODE: RAM at 0
+                return self.ram, addr % RAM_SIZE, 0
+            return self.flash, addr, self.flashWait
+        if FLASH_BASE <= addr < FLASH_BASE + FLASH_SIZE:
+            return self.flash, addr - FLASH_BASE, self.flashWait
+        if RAM_BASE <= addr < RAM_BASE + RAM_SIZE:
+            return self.ram, addr - RAM_BASE, 0
+        return None, addr, 0
+
+    def read(self, addr: int, size: int):
+        mem, offset, wait = self.region(addr)
+        if mem is not None:
+            if offset + size > len(mem):
+                raise SimError('read of {} bytes at {:#010x} runs off the end of memory'.format(size, addr))
+            return int.from_bytes(mem[offset:offset + size], 'little'), wait
+        if PERIPH_BASE <= addr < PERIPH_END:
+            word = self.periph.read(addr)
+            return (word >> (8 * (addr & 3))) & ((1 << (8 * size)) - 1), self.periphWait
+        if addr >= SCS_BASE:
+            return self.scs.get(addr & ~3, 0) >> (8 * (addr & 3)) & ((1 << (8 * size)) - 1), 0
+        raise SimError('read from unmapped address {:#010x}'.format(addr))
+
+    def write(self, addr: int, size: int, value: int):
+        mem, offset, wait = self.region(addr)
+        if mem is self.ram:
+            self.ram[offset:offset + size] = (value & ((1 << (8 * size)) - 1)).to_bytes(size, 'little')
+            return 0
+        if mem is self.flash:
+            raise SimError('write to flash at {:#010x} (the flash controller isn\'t modelled)'.format(addr))
+        if PERIPH_BASE <= addr < PERIPH_END or addr >= SCS_BASE:
+            # narrow writes land in their lane of the word, the way the bus presents them
+            shift = 8 * (addr & 3)
+            mask = ((1 << (8 * size)) - 1) << shift
+            if addr >= SCS_BASE:
+                self.scs[addr & ~3] = (self.scs.get(addr & ~3, 0) & ~mask) | ((value << shift) & mask)
+                return 0
+            old = self.periph.regs.get(addr & ~3, 0)
+            self.periph.write(addr, (old & ~mask) | ((value << shift) & mask))
+            return self.periphWait
+        raise SimError('write to unmapped address {:#010x}'.format(addr))
+
+    def load(self, addr: int, data: bytes):
+        mem, offset, _ = self.region(addr)
+        if mem is None:
+            raise SimError('can\'t load {} bytes at {:#010x}'.format(len(data), addr))
+        mem[offset:offset + len(data)] = data
+
+
+class Cpu:
+    """
+    ARMv6-M (Cortex-M0) interpreter that counts cycles.
+
+    Instruction timings are from the Cortex-M0 TRM (table 3-1). On top of those:
+      - data accesses to flash cost flashWait extra cycles, and peripheral accesses periphWait
+      - the core fetches 32 bits at a time. A fetch from flash costs flashWait cycles, except sequential fetches
+        when the prefetch buffer is on (FLASH_ACR.PRFTBE, which SystemInit sets)
+    """
+
+    def __init__(self, flashWait: int = 1, periphWait: int = 1, prefetch: bool = True, fastMultiply: bool = True):
+        self.mem = Memory(self, flashWait, periphWait)
+        self.flashWait = flashWait
+        self.prefetch = prefetch
+        self.mulCycles = 1 if fastMultiply else 32
+        self.r = [0] * 16
+        self.n = self.z = self.c = self.v = 0
+        self.cycles = 0
+        self.instructions = 0
+        self.lastFetch = None
+        self.profile = None  # pc -> cycles, when enabled
+
+    # ---- registers and flags
+
+    def setNZ(self, result: int):
+        self.n = result >> 31
+        self.z = int(result == 0)
+
+    def condition(self, cond: int):
+        n, z, c, v = self.n, self.z, self.c, self.v
+        return [z, not z, c, not c, n, not n, v, not v,
+                c and not z, not c or z, n == v, n != v, not z and n == v, z or n != v, True, True][cond]
+
+    # ---- memory
+
+    def load(self, addr: int, size: int):
+        if addr & (size - 1):
+            raise SimError('unaligned {} byte load from {:#010x} at pc {:#010x}'.format(size, addr, self.pc))
+        value, wait = self.mem.read(addr, size)
+        self.cycles += wait
+        return value
+
+    def store(self, addr: int, size: int, value: int):
+        if addr & (size - 1):
+            raise SimError('unaligned {} byte store to {:#010x} at pc {:#010x}'.format(size, addr, self.pc))
+        self.cycles += self.mem.write(addr, size, value)
+
+    def fetch(self, addr: int):
+        word = addr & ~3
+        if word != self.lastFetch:
+            sequential = self.lastFetch is not None and word == self.lastFetch + 4
+            _, _, wait = self.mem.region(addr)
+            if not (sequential and self.prefetch):
+                self.cycles += wait
+            self.lastFetch = word
+        return self.mem.read(addr, 2)[0]
+
+    def branch(self, target: int):
+        self.r[15] = target & MASK & ~1
+        self.lastFetch = None  # the pipeline refills from the new address
+
+    # ---- running
+
+    def call(self, addr: int, args=(), sp: int = RAM_BASE + RAM_SIZE, maxCycles: int = 10_000_000):
+        """
+        Run the function at addr until it returns, and give back the cycles it took
+        """
+        for i, a in enumerate(args):
+            self.r[i] = a & MASK
+        self.r[13] = sp
+        self.r[14] = RETURN_MAGIC | 1
+        self.branch(addr)
+        start = self.cycles
+        while self.r[15] != RETURN_MAGIC:
+            self.step()
+            if self.cycles - start > maxCycles:
+                raise SimError('still running after {} cycles, at pc {:#010x}'.format(maxCycles, self.r[15]))
+        return self.cycles - start
+
+    def step(self):
+        self.pc = self.r[15]
+        before = self.cycles
+        op = self.fetch(self.pc)
+        self.r[15] = self.pc + 2
+        self.instructions += 1
+        self.execute(op)
+        if self.profile is not None:
+            self.profile[self.pc] = self.profile.get(self.pc, 0) + self.cycles - before
+
+    def reg(self, i: int):
+        # reading the pc gives the address of the instruction plus 4
+        return (self.pc + 4) & MASK if i == 15 else self.r[i]
+
+    def execute(self, op: int):
+        r = self.r
+        top = op >> 11
+
+        if top < 3:  # LSLS, LSRS, ASRS immediate
+            imm = (op >> 6) & 31
+            m, d = (op >> 3) & 7, op & 7
+            value = r[m]
+            if top == 0:
+                if imm:
+                    self.c = (value >> (32 - imm)) & 1
+                    value = (value << imm) & MASK
+            elif top == 1:
+                imm = imm or 32
+                self.c = (value >> (imm - 1)) & 1
+                value = value >> imm
+            else:
+                imm = imm or 32
+                self.c = (value >> (imm - 1)) & 1 if imm < 32 else value >> 31
+                value = (signed(value) >> min(imm, 31)) & MASK
+            r[d] = value
+            self.setNZ(value)
+            self.cycles += 1
+
+        elif top == 3:  # ADDS/SUBS register or 3 bit immediate
+            d, n = op & 7, (op >> 3) & 7
+            operand = (op >> 6) & 7 if op & 0x400 else r[(op >> 6) & 7]
+            if op & 0x200:
+                result, self.c, self.v = addWithCarry(r[n], ~operand & MASK, 1)
+            else:
+                result, self.c, self.v = addWithCarry(r[n], operand, 0)
+            r[d] = result
+            self.setNZ(result)
+            self.cycles += 1
+
+        elif top < 8:  # MOVS, CMP, ADDS, SUBS with an 8 bit immediate
+            d, imm = (op >> 8) & 7, op & 0xFF
+            kind = top - 4
+            if kind == 0:
+                r[d] = imm
+                self.setNZ(imm)
+            elif kind == 2:
+                r[d], self.c, self.v = addWithCarry(r[d], imm, 0)
+                self.setNZ(r[d])
+            else:
+                result, self.c, self.v = addWithCarry(r[d], ~imm & MASK, 1)
+                self.setNZ(result)
+                if kind == 3:
+                    r[d] = result
+            self.cycles += 1
+
+        elif op >> 10 == 0x10:
+            self.dataProcessing(op)
+
+        elif op >> 10 == 0x11:
+            self.specialData(op)
+
+        elif top == 9:  # LDR literal
+            d = (op >> 8) & 7
+            r[d] = self.load(((self.pc + 4) & ~3) + (op & 0xFF) * 4, 4)
+            self.cycles += 2
+
+        elif op >> 12 == 5:  # load/store with a register offset
+            addr = (r[(op >> 3) & 7] + r[(op >> 6) & 7]) & MASK
+            d = op & 7
+            kind = (op >> 9) & 7
+            if kind == 0:
+                self.store(addr, 4, r[d])
+            elif kind == 1:
+                self.store(addr, 2, r[d])
+            elif kind == 2:
+                self.store(addr, 1, r[d])
+            elif kind == 3:
+                r[d] = signExtend(self.load(addr, 1), 8)
+            elif kind == 4:
+                r[d] = self.load(addr, 4)
+            elif kind == 5:
+                r[d] = self.load(addr, 2)
+            elif kind == 6:
+                r[d] = self.load(addr, 1)
+            else:
+                r[d] = signExtend(self.load(addr, 2), 16)
+            self.cycles += 2
+
+        elif op >> 13 == 3:  # STR/LDR/STRB/LDRB with an immediate offset
+            size = 1 if op & 0x1000 else 4
+            addr = (r[(op >> 3) & 7] + ((op >> 6) & 31) * size) & MASK
+            self.loadStore(op, addr, size)
+
+        elif op >> 12 == 8:  # STRH/LDRH immediate
+            addr = (r[(op >> 3) & 7] + ((op >> 6) & 31) * 2) & MASK
+            self.loadStore(op, addr, 2)
+
+        elif op >> 12 == 9:  # STR/LDR sp relative
+            d = (op >> 8) & 7
+            addr = (r[13] + (op & 0xFF) * 4) & MASK
+            if op & 0x800:
+                r[d] = self.load(addr, 4)
+            else:
+                self.store(addr, 4, r[d])
+            self.cycles += 2
+
+        elif op >> 12 == 10:  # ADR, and ADD rd, sp, #imm
+            d = (op >> 8) & 7
+            base = r[13] if op & 0x800 else (self.pc + 4) & ~3
+            r[d] = (base + (op & 0xFF) * 4) & MASK
+            self.cycles += 1
+
+        elif op >> 12 == 11:
+            self.misc(op)
+
+        elif op >> 12 == 12:  # STM/LDM
+            n = (op >> 8) & 7
+            regs = [i for i in range(8) if op & (1 << i)]
+            addr = r[n]
+            for i in regs:
+                if op & 0x800:
+                    r[i] = self.load(addr, 4)
+                else:
+                    self.store(addr, 4, r[i])
+                addr += 4
+            if not (op & 0x800 and n in regs):  # writeback, unless the base was loaded
+                r[n] = addr & MASK
+            self.cycles += 1 + len(regs)
+
+        elif op >> 12 == 13:
+            cond = (op >> 8) & 15
+            if cond == 15:
+                raise SimError('SVC {} at pc {:#010x}'.format(op & 0xFF, self.pc))
+            if cond == 14:
+                raise SimError('UDF at pc {:#010x}'.format(self.pc))
+            if self.condition(cond):
+                self.branch(self.pc + 4 + signExtend((op & 0xFF) << 1, 9))
+                self.cycles += 3
+            else:
+                self.cycles += 1
+
+        elif top == 0x1C:  # B
+            self.branch(self.pc + 4 + signExtend((op & 0x7FF) << 1, 12))
+            self.cycles += 3
+
+        elif top == 0x1E:  # 32 bit: BL, MSR, MRS, barriers
+            self.wide(op, self.fetch(self.pc + 2))
+
+        else:
+            raise SimError('undefined instruction {:#06x} at pc {:#010x}'.format(op, self.pc))
+
+    def loadStore(self, op: int, addr: int, size: int):
+        d = op & 7
+        if op & 0x800:
+            self.r[d] = self.load(addr, size)
+        else:
+            self.store(addr, size, self.r[d])
+        self.cycles += 2
+
+    def dataProcessing(self, op: int):
+        r = self.r
+        kind = (op >> 6) & 15
+        m, d = (op >> 3) & 7, op & 7
+        a, b = r[d], r[m]
+        result = None
+        self.cycles += 1
+
+        if kind == 0:  # ANDS
+            result = a & b
+        elif kind == 1:  # EORS
+            result = a ^ b
+        elif kind in (2, 3, 4, 7):  # shifts by register
+            amount = b & 0xFF
+            result = a
+            if amount:
+                if kind == 2:  # LSLS
+                    self.c = (a >> (32 - amount)) & 1 if amount <= 32 else 0
+                    result = (a << amount) & MASK if amount < 32 else 0
+                elif kind == 3:  # LSRS
+                    self.c = (a >> (amount - 1)) & 1 if amount <= 32 else 0
+                    result = a >> amount if amount < 32 else 0
+                elif kind == 4:  # ASRS
+                    self.c = (a >> (amount - 1)) & 1 if amount < 32 else a >> 31
+                    result = (signed(a) >> min(amount, 31)) & MASK
+                else:  # RORS
+                    rot = amount & 31
+                    result = ((a >> rot) | (a << (32 - rot))) & MASK if rot else a
+                    self.c = result >> 31
+        elif kind == 5:  # ADCS
+            result, self.c, self.v = addWithCarry(a, b, self.c)
+        elif kind == 6:  # SBCS
+            result, self.c, self.v = addWithCarry(a, ~b & MASK, self.c)
+        elif kind == 8:  # TST
+            self.setNZ(a & b)
+        elif kind == 9:  # RSBS (NEGS)
+            result, self.c, self.v = addWithCarry(~b & MASK, 0, 1)
+        elif kind == 10:  # CMP
+            value, self.c, self.v = addWithCarry(a, ~b & MASK, 1)
+            self.setNZ(value)
+        elif kind == 11:  # CMN
+            value, self.c, self.v = addWithCarry(a, b, 0)
+            self.setNZ(value)
+        elif kind == 12:  # ORRS
+            result = a | b
+        elif kind == 13:  # MULS
+            result = (a * b) & MASK
+            self.cycles += self.mulCycles - 1
+        elif kind == 14:  # BICS
+            result = a & ~b & MASK
+        else:  # MVNS
+            result = ~b & MASK
+
+        if result is not None:
+            r[d] = result
+            self.setNZ(result)
+
+    def specialData(self, op: int):
+        r = self.r
+        kind = (op >> 8) & 3
+        m = (op >> 3) & 15
+        d = (op & 7) | ((op >> 4) & 8)
+        if kind == 0:  # ADD with high registers
+            result = (self.reg(d) + self.reg(m)) & MASK
+            self.writeHigh(d, result)
+        elif kind == 1:  # CMP with high registers
+            value, self.c, self.v = addWithCarry(self.reg(d), ~self.reg(m) & MASK, 1)
+            self.setNZ(value)
+            self.cycles += 1
+        elif kind == 2:  # MOV
+            self.writeHigh(d, self.reg(m))
+        else:  # BX, BLX
+            target = self.reg(m)
+            if not target & 1:  # an interworking branch to ARM state, which the M0 doesn't have
+                raise SimError('BX to ARM state address {:#010x} at pc {:#010x}'.format(target, self.pc))
+            if op & 0x80:
+                r[14] = (self.pc + 2) | 1
+            self.branch(target)
+            self.cycles += 3
+
+    def writeHigh(self, d: int, value: int):
+        if d == 15:
+            self.branch(value)
+            self.cycles += 3
+        else:
+            self.r[d] = value
+            self.cycles += 1
+
+    def misc(self, op: int):
+        r = self.r
+        if op & 0xFF00 == 0xB000:  # ADD/SUB sp, #imm
+            imm = (op & 0x7F) * 4
+            r[13] = (r[13] - imm if op & 0x80 else r[13] + imm) & MASK
+            self.cycles += 1
+        elif op & 0xFF00 == 0xB200:  # SXTH, SXTB, UXTH, UXTB
+            m, d = (op >> 3) & 7, op & 7
+            kind = (op >> 6) & 3
+            value = r[m]
+            r[d] = [signExtend(value & 0xFFFF, 16), signExtend(value & 0xFF, 8), value & 0xFFFF, value & 0xFF][kind]
+            self.cycles += 1
+        elif op & 0xFE00 == 0xB400:  # PUSH
+            regs = [i for i in range(8) if op & (1 << i)] + ([14] if op & 0x100 else [])
+            addr = r[13] - 4 * len(regs)
+            r[13] = addr & MASK
+            for i in regs:
+                self.store(addr, 4, r[i])
+                addr += 4
+            self.cycles += 1 + len(regs)
+        elif op & 0xFE00 == 0xBC00:  # POP
+            regs = [i for i in range(8) if op & (1 << i)]
+            addr = r[13]
+            for i in regs:
+                r[i] = self.load(addr, 4)
+                addr += 4
+            self.cycles += 1 + len(regs)
+            if op & 0x100:  # pop and return is 3 + N, counting the pc
+                target = self.load(addr, 4)
+                addr += 4
+                self.branch(target)
+                self.cycles += 3
+            r[13] = addr & MASK
+        elif op & 0xFFE8 == 0xB660:  # CPSIE/CPSID
+            self.cycles += 1
+        elif op & 0xFF00 == 0xBA00:  # REV, REV16, REVSH
+            m, d = (op >> 3) & 7, op & 7
+            b = r[m].to_bytes(4, 'little')
+            kind = (op >> 6) & 3
+            if kind == 0:
+                r[d] = int.from_bytes(b, 'big')
+            elif kind == 1:
+                r[d] = int.from_bytes(bytes([b[1], b[0], b[3], b[2]]), 'little')
+            elif kind == 3:
+                r[d] = signExtend((b[0] << 8) | b[1], 16)
+            else:
+                raise SimError('undefined instruction {:#06x} at pc {:#010x}'.format(op, self.pc))
+            self.cycles += 1
+        elif op & 0xFF00 == 0xBE00:
+            raise SimError('BKPT {} at pc {:#010x}'.format(op & 0xFF, self.pc))
+        elif op & 0xFF00 == 0xBF00:  # hints: NOP, YIELD, WFE, WFI, SEV
+            self.cycles += 2 if op & 0xF0 in (0x20, 0x30) else 1
+        else:
+            raise SimError('undefined instruction {:#06x} at pc {:#010x}'.format(op, self.pc))
+
+    def wide(self, first: int, second: int):
+        self.r[15] = self.pc + 4
+        if second & 0xD000 == 0xD000:  # BL
+            s = (first >> 10) & 1
+            j1, j2 = (second >> 13) & 1, (second >> 11) & 1
+            i1, i2 = 1 - (j1 ^ s), 1 - (j2 ^ s)
+            offset = (s << 24) | (i1 << 23) | (i2 << 22) | ((first & 0x3FF) << 12) | ((second & 0x7FF) << 1)
+            self.r[14] = (self.pc + 4) | 1
+            self.branch(self.pc + 4 + signExtend(offset, 25))
+            self.cycles += 4
+        elif first & 0xFFF0 == 0xF380 or first & 0xFFFF == 0xF3EF or first & 0xFFF0 == 0xF3B0:
+            # MSR, MRS and the DMB/DSB/ISB barriers. Special registers aren't modelled, MRS reads 0
+            if first & 0xFFFF == 0xF3EF:
+                self.r[(second >> 8) & 15] = 0
+            self.cycles += 4
+        else:
+            raise SimError('undefined instruction {:#06x} {:#06x} at pc {:#010x}'.format(first, second, self.pc))
@@ -0,0 +1,55 @@
+import struct
+
+PT_LOAD = 1
+SHT_SYMTAB = 2
+STT_FUNC = 2
+
+
+class Elf:
+    """
+    Just enough of a 32 bit little endian ELF reader to load the firmware: the loadable segments and the symbol table
+    """
+
+    def __init__(self, path: str):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+        if self.data[:4] != b'\x7fELF' or self.data[4] != 1 or self.data[5] != 1:
+            raise ValueError('{} is not a 32 bit little endian ELF'.format(path))
+
+        (self.entry, phoff, shoff, _, _, phentsize, phnum, shentsize, shnum, shstrndx) = \
+            struct.unpack_from('<IIIIHHHHHH', self.data, 24)
+
+        # (physical address, virtual address, bytes in the file, size in memory)
+        self.segments = []
+        for i in range(phnum):
+            ptype, offset, vaddr, paddr, filesz, memsz = struct.unpack_from('<IIIIII', self.data, phoff + i * phentsize)
+            if ptype == PT_LOAD:
+                self.segments.append((paddr, vaddr, self.data[offset:offset + filesz], memsz))
+
+        sections = [struct.unpack_from('<IIIIIIIIII', self.data, shoff + i * shentsize) for i in range(shnum)]
+        self.symbols = {}
+        for name, stype, _, _, offset, size, link, _, _, entsize in sections:
+            if stype != SHT_SYMTAB:
+                continue
+            strtab = sections[link]
+            for pos in range(offset, offset + size, entsize):
+                nameOff, value, symSize, info, _, _ = struct.unpack_from('<IIIBBH', self.data, pos)
+                symName = self.string(strtab[4], nameOff)
+                if symName and not symName.startswith('$'):  # skip the $t/$d mapping symbols
+                    self.symbols[symName] = (value, symSize, info & 0xf)
+
+    def string(self, tableOffset: int, offset: int):
+        start = tableOffset + offset
+        return self.data[start:self.data.index(b'\0', start)].decode()
+
+    def symbol(self, name: str):
+        if name not in self.symbols:
+            raise KeyError('no symbol {} in the ELF'.format(name))
+        return self.symbols[name][0]
+
+    # the function (or object) containing an address, for profiles
+    def nameAt(self, addr: int):
+        for name, (value, size, _) in self.symbols.items():
+            if value & ~1 <= addr < (value & ~1) + max(size, 1):
+                return name
+        return None
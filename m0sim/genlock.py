@@ -0,0 +1,259 @@
+"""
+Off-target check of genlock (src/genlock.c): a synthetic sync source with a clock of its own drives the hsync and vsync
+inputs, and the firmware's line and frame interrupts run against it in the simulator. The timer hardware the firmware
+sets up for it (TIM3 and TIM2 capturing and resetting on their CC1 input) is modelled here, between interrupts.
+For each source it checks that the firmware locks within the allowed frames and says how long it took, that the line
+error it reports is the source's line length by this board's clock, and that once it's locked every line of the
+source's frame shows the same row as it would on the source board.
+"""
+
+import argparse
+import heapq
+import math
+import struct
+import sys
+from cpu import SimError
+from elf import Elf
+from main import EXCEPTION_CYCLES, PERIPHERALS, REGISTERS, loadFirmware, newCpu
+from scanout import DMA_CCR, DMA_CMAR, FIRST_VISIBLE, FRAME_LINES, HEIGHT, LINE_CYCLES, TIM15_DIER, VISIBLE_LINES, WIDTH
+
+# must match inc/genlock.h
+GENLOCK_LOCKED = 2
+GENLOCK_HSYNC_FALLING = 0x1
+GENLOCK_VSYNC_FALLING = 0x2
+GENLOCK_TOLERANCE = 24
+
+HSYNC_WIDTH = 128  # TIM3 CCR2
+VSYNC_LINES = 4  # TIM2 CCR2
+FRAME_CYCLES = FRAME_LINES * LINE_CYCLES
+STATES = ['off', 'searching', 'locked']
+
+# (ppm, offset) sources checked when none are given: the same clock, and HSI boards a fraction of a percent to 1.5% apart
+DEFAULT_SOURCES = [(0, 0), (2500, 123456), (-10000, 400000), (15000, 650000)]
+
+
+class SyncSource:
+    """
+    Another board's sync outputs. Its clock is ppm parts per million slower than this board's, so each of its lines is
+    that much longer by this board's clock, and it's offset cycles into its frame when this board's timers start.
+    Its vsync starts lead cycles before the hsync of the first line, since it enables TIM2 just before TIM3
+    """
+
+    def __init__(self, ppm: int, offset: int, lead: int):
+        self.ppm = ppm
+        self.line = LINE_CYCLES * (1 + ppm / 1e6)
+        self.offset = offset
+        self.lead = lead
+
+    # when the source's nth line starts (counting from the start of its frame 0), relative to this board starting
+    def hsync(self, n: int):
+        return round(n * self.line - self.offset)
+
+    # the source's line that's being drawn at time t
+    def lineAt(self, t: int):
+        return math.floor((t + self.offset) / self.line)
+
+    # every edge on the sync inputs during the source's nth line: (time, timer, falling)
+    def edges(self, n: int):
+        start = self.hsync(n)
+        yield start, 'TIM3', False
+        yield start + round(HSYNC_WIDTH * self.line / LINE_CYCLES), 'TIM3', True
+        if n % FRAME_LINES == 0:
+            yield start - self.lead, 'TIM2', False
+            yield start - self.lead + round(VSYNC_LINES * self.line), 'TIM2', True
+
+
+class Timers:
+    """
+    What the simulator's peripherals don't do by themselves: a timer whose CC1 is a capture of its input and whose slave
+    mode resets it on that input (SMCR trigger TI1FP1, reset mode) captures its count and starts again from 0 on the edge
+    """
+
+    def __init__(self, cpu):
+        self.periph = cpu.mem.periph
+
+    def reg(self, timer: str, name: str):
+        return PERIPHERALS[timer] + REGISTERS['TIM'][name]
+
+    def read(self, timer: str, name: str):
+        return self.periph.regs.get(self.reg(timer, name), 0)
+
+    def countAt(self, timer: str, t: int):
+        base = PERIPHERALS[timer]
+        count, since = self.periph.counterBase.get(base, (self.read(timer, 'CNT'), t))
+        return (count + t - since) % (self.read(timer, 'ARR') + 1)
+
+    def listening(self, timer: str):
+        return (self.read(timer, 'SMCR') & 0x77 == 0x54 and self.read(timer, 'CCMR1') & 3 == 1
+                and self.read(timer, 'CCER') & 1)
+
+    # an edge on the timer's CC1 pin at time t, gives back whether the timer took it
+    def edge(self, timer: str, t: int, falling: bool):
+        if not self.listening(timer) or bool(self.read(timer, 'CCER') & 2) != falling:
+            return False
+        regs = self.periph.regs
+        regs[self.reg(timer, 'CCR1')] = self.countAt(timer, t)
+        regs[self.reg(timer, 'SR')] = self.read(timer, 'SR') | 2
+        self.periph.counterBase[PERIPHERALS[timer]] = (0, t)
+        return True
+
+    # the next time after t the timer gets to its CCR3, which is when its interrupt fires
+    def nextInterrupt(self, timer: str, t: int):
+        t += 1
+        return t + (self.read(timer, 'CCR3') - self.countAt(timer, t)) % (self.read(timer, 'ARR') + 1)
+
+
+# the row the source board shows on a line of its frame, or None outside the visible region
+def sourceRow(line: int):
+    line %= FRAME_LINES
+    if FIRST_VISIBLE <= line < FIRST_VISIBLE + VISIBLE_LINES:
+        return (line - FIRST_VISIBLE) // (VISIBLE_LINES // HEIGHT)
+    return None
+
+
+def checkSource(args, elf: Elf, source: SyncSource):
+    cpu = newCpu(args)
+    loadFirmware(elf, cpu)
+    mem = cpu.mem
+    timers = Timers(cpu)
+
+    def call(name: str, callArgs=()):
+        return cpu.call(elf.symbol(name), callArgs)
+
+    def word(name: str):
+        return mem.read(elf.symbol(name), 4)[0]
+
+    def signedWord(name: str):
+        return struct.unpack('<i', word(name).to_bytes(4, 'little'))[0]
+
+    call('setupHorizontalTimers')
+    call('setupVerticalTimer')
+    mem.write(elf.symbol('frame'), 4, elf.symbol('screen'))  # what showAsset would do, so the DMA has rows to show
+    mem.periph.write(timers.reg('TIM2', 'CR1'), timers.read('TIM2', 'CR1') | 1)
+    mem.periph.write(timers.reg('TIM3', 'CR1'), timers.read('TIM3', 'CR1') | 1)
+    start = cpu.cycles
+    call('genlockStart', [args.flags])
+
+    # the source's edges from its first line after the start, a few lines ahead of the interrupts
+    edges = []
+    nextLine = source.lineAt(0) + 1
+    falling = {'TIM3': bool(args.flags & GENLOCK_HSYNC_FALLING), 'TIM2': bool(args.flags & GENLOCK_VSYNC_FALLING)}
+
+    def queueUntil(t: int):
+        nonlocal nextLine
+        while start + source.hsync(nextLine) <= t + 2 * LINE_CYCLES:
+            for e in source.edges(nextLine):
+                heapq.heappush(edges, (e[0] + start, e[1], e[2]))
+            nextLine += 1
+
+    # interrupts are looked for from the last event rather than from where the CPU is, so one that comes in while
+    # another is running is taken straight after it
+    now = cpu.cycles
+    frames = []
+    wrong = 0
+    missed = 0
+    while len(frames) < args.frames:
+        lineAt = timers.nextInterrupt('TIM3', now)
+        frameAt = timers.nextInterrupt('TIM2', now)
+        at = min(lineAt, frameAt)
+        queueUntil(at)
+        if edges and edges[0][0] <= at:
+            t, timer, isFalling = heapq.heappop(edges)
+            taken = timers.edge(timer, t, isFalling)
+            missed += isFalling == falling[timer] and not taken
+            now = max(now, t)
+            continue
+
+        now = at
+        cpu.cycles = max(cpu.cycles, at) + EXCEPTION_CYCLES
+        if lineAt <= frameAt:
+            call('TIM3_IRQHandler')
+            # the DMA now has the row for the source's next line, or is off
+            line = source.lineAt(at - start) + 1
+            on = mem.periph.regs.get(DMA_CCR, 0) & 1 and mem.periph.regs.get(TIM15_DIER, 0) & (1 << 9)
+            shown = (mem.periph.regs.get(DMA_CMAR, 0) - word('frame')) // (WIDTH + 1) if on else None
+            wrong += shown != sourceRow(line)
+            cpu.cycles += EXCEPTION_CYCLES
+        else:
+            call('TIM2_IRQHandler')
+            cpu.cycles += EXCEPTION_CYCLES
+            call('updateFrame')  # the main loop wakes up to the vblank flag
+            frames.append((mem.read(elf.symbol('genlockState'), 1)[0], signedWord('genlockLineError'),
+                           signedWord('genlockFrameError'), word('genlockLockFrames'), wrong, missed))
+            wrong = 0
+            missed = 0
+
+    print('source {:+6} ppm, {:6} cycles into its frame'.format(source.ppm, source.offset))
+    expected = source.line - LINE_CYCLES
+    lockedAt = next((i for i, f in enumerate(frames) if f[0] == GENLOCK_LOCKED), None)
+    errors = []
+    for i, (state, lineError, frameError, lockFrames, wrongLines, missedEdges) in enumerate(frames):
+        print('  frame {}: {:9}  line error {:4}  frame error {:7}  {:3} lines showing the wrong row'.format(
+            i + 1, STATES[state] if state < len(STATES) else state, lineError, frameError, wrongLines))
+        if missedEdges:
+            errors.append('frame {}: the timers ignored {} sync edges, check the capture and slave mode setup'.format(
+                i + 1, missedEdges))
+        if lockedAt is None or i < lockedAt:
+            continue
+        if state != GENLOCK_LOCKED:
+            errors.append('frame {}: lost the lock'.format(i + 1))
+        if abs(lineError - expected) > 1:
+            errors.append('frame {}: line error {} but the source lines are {:.1f} cycles off'.format(
+                i + 1, lineError, expected))
+        if abs(frameError) > GENLOCK_TOLERANCE:
+            errors.append('frame {}: frame error {} is over the tolerance'.format(i + 1, frameError))
+        if i > lockedAt and wrongLines:
+            errors.append('frame {}: {} lines show a different row than the source'.format(i + 1, wrongLines))
+
+    if lockedAt is None:
+        errors.append('never locked')
+    else:
+        if lockedAt + 1 > args.max_lock:
+            errors.append('took {} frames to lock, over the {} allowed'.format(lockedAt + 1, args.max_lock))
+        if frames[lockedAt][3] != lockedAt + 1:
+            errors.append('reported the lock after {} frames but it took {}'.format(frames[lockedAt][3], lockedAt + 1))
+    for e in errors[:args.max_errors]:
+        print('    ' + e)
+    if len(errors) > args.max_errors:
+        print('    ... and {} more'.format(len(errors) - args.max_errors))
+    print('  ' + ('locked in {} frames ({:.1f} ms)'.format(lockedAt + 1, (lockedAt + 1) * FRAME_CYCLES / 40e3)
+                  if lockedAt is not None else 'no lock') + (', ok' if not errors else ', FAIL'))
+    return bool(errors)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run genlock against synthetic sync sources and check that it locks')
+    parser.add_argument('elf')
+    parser.add_argument('--ppm', type=int, action='append', help='how much slower the source clock is, in ppm')
+    parser.add_argument('--offset', type=int, action='append', help='cycles into its frame the source is at the start')
+    parser.add_argument('--lead', type=int, default=4, help='cycles the source vsync comes before its hsync')
+    parser.add_argument('--flags', type=int, default=0, help='genlockStart flags, 1 = hsync falling, 2 = vsync falling')
+    parser.add_argument('--frames', type=int, default=8, help='frames to run against each source')
+    parser.add_argument('--max-lock', type=int, default=4, help='frames it may take to lock')
+    parser.add_argument('--max-errors', type=int, default=5, help='problems to list for each source')
+    parser.add_argument('--wait', type=int, default=1, help='flash wait states (1 above 24 MHz)')
+    parser.add_argument('--periph-wait', type=int, default=1, help='extra cycles for each peripheral access')
+    parser.add_argument('--no-prefetch', action='store_true', help='model the flash prefetch buffer as off')
+    args = parser.parse_args()
+
+    if args.ppm or args.offset:
+        ppms = args.ppm or [0]
+        offsets = args.offset or [0]
+        sources = [(ppm, offset) for ppm in ppms for offset in offsets]
+    else:
+        sources = DEFAULT_SOURCES
+
+    elf = Elf(args.elf)
+    failed = 0
+    for ppm, offset in sources:
+        try:
+            failed += checkSource(args, elf, SyncSource(ppm, offset % FRAME_CYCLES, args.lead))
+        except SimError as e:
+            print('source {:+6} ppm: ERROR {}'.format(ppm, e))
+            failed += 1
+    print('{} sources failed'.format(failed) if failed else 'locked to every source')
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,149 @@
+import argparse
+import sys
+from cpu import Cpu, SimError
+from elf import Elf
+
+# exception entry and return on the M0 (the TRM's zero wait state interrupt latency, and the same again to unstack)
+EXCEPTION_CYCLES = 16
+
+# names for the registers the firmware touches, so benchmarks can set them up by name
+PERIPHERALS = {
+    'TIM2': 0x40000000, 'TIM3': 0x40000400, 'TIM15': 0x40014000,
+    'DMA1': 0x40020000, 'DMA1_Channel4': 0x40020044, 'DMA1_Channel5': 0x40020058,
+    'GPIOA': 0x48000000, 'GPIOB': 0x48000400, 'GPIOC': 0x48000800,
+    'RCC': 0x40021000, 'FLASH': 0x40022000, 'CRC': 0x40023000, 'USART1': 0x40013800, 'SYSCFG': 0x40010000,
+    'SPI1': 0x40013000, 'SPI2': 0x40003800, 'ADC1': 0x40012400,
+}
+REGISTERS = {
+    'TIM': {'CR1': 0x00, 'CR2': 0x04, 'SMCR': 0x08, 'DIER': 0x0C, 'SR': 0x10, 'EGR': 0x14, 'CCMR1': 0x18,
+            'CCER': 0x20, 'CNT': 0x24, 'PSC': 0x28, 'ARR': 0x2C, 'RCR': 0x30,
+            'CCR1': 0x34, 'CCR2': 0x38, 'CCR3': 0x3C, 'CCR4': 0x40},
+    'DMA1_Channel': {'CCR': 0x00, 'CNDTR': 0x04, 'CPAR': 0x08, 'CMAR': 0x0C},
+    'DMA1': {'ISR': 0x00, 'IFCR': 0x04},
+    'GPIO': {'MODER': 0x00, 'IDR': 0x10, 'ODR': 0x14, 'BSRR': 0x18, 'BRR': 0x28},
+    'USART': {'CR1': 0x00, 'BRR': 0x0C, 'ISR': 0x1C, 'ICR': 0x20, 'RDR': 0x24, 'TDR': 0x28},
+    'FLASH': {'ACR': 0x00, 'SR': 0x0C, 'CR': 0x10},
+    'CRC': {'DR': 0x00, 'CR': 0x08},
+    'SYSCFG': {'CFGR1': 0x00},
+    'SPI': {'CR1': 0x00, 'CR2': 0x04, 'SR': 0x08, 'DR': 0x0C},
+    'ADC': {'ISR': 0x00, 'CR': 0x08, 'CFGR1': 0x0C, 'DR': 0x40},
+    'RCC': {'CR': 0x00, 'CFGR': 0x04, 'AHBENR': 0x14, 'APB2ENR': 0x18, 'APB1ENR': 0x1C},
+}
+
+
+def loadFirmware(elf: Elf, cpu: Cpu):
+    # flash gets the load image, and anything that runs from RAM (.data, .RamFunc) is copied the way the startup code does
+    for paddr, vaddr, data, memsz in elf.segments:
+        if data:
+            cpu.mem.load(paddr, data)
+            if vaddr != paddr:
+                cpu.mem.load(vaddr, data)
+
+
+# an address from a number, symbol, PERIPHERAL.REGISTER name, or any of those plus an offset
+def resolve(elf: Elf, text: str):
+    base, _, offset = text.partition('+')
+    extra = int(offset, 0) if offset else 0
+    try:
+        return int(base, 0) + extra
+    except ValueError:
+        pass
+    if '.' in base:
+        periph, reg = base.split('.')
+        kind = next(k for k in REGISTERS if periph.startswith(k))
+        return PERIPHERALS[periph] + REGISTERS[kind][reg] + extra
+    return (elf.symbol(base) & ~1) + extra
+
+
+# apply NAME[:SIZE]=VALUE settings. r0..r3 are the call arguments, anything else is written to memory
+def applySettings(elf: Elf, cpu: Cpu, settings):
+    args = [0, 0, 0, 0]
+    for setting in settings:
+        target, value = setting.split('=')
+        value = resolve(elf, value)
+        if target in ('r0', 'r1', 'r2', 'r3'):
+            args[int(target[1])] = value
+            continue
+        target, _, size = target.partition(':')
+        cpu.mem.write(resolve(elf, target), int(size) if size else 4, value)
+    return args
+
+
+def run(elf: Elf, cpu: Cpu, function: str, settings, setup=()):
+    for name in setup:
+        cpu.call(elf.symbol(name))
+    cpu.instructions = 0
+    if cpu.profile:
+        cpu.profile.clear()
+    args = applySettings(elf, cpu, settings)
+    cycles = cpu.call(elf.symbol(function), args)
+    if function.endswith('_Handler') or function.endswith('_IRQHandler'):
+        cycles += 2 * EXCEPTION_CYCLES
+    return cycles
+
+
+def newCpu(args):
+    return Cpu(flashWait=args.wait, periphWait=args.periph_wait, prefetch=not args.no_prefetch)
+
+
+# a suite has one benchmark per line: name, function, cycle budget, then settings and @setup functions
+def runSuite(args, elf: Elf):
+    failed = 0
+    with open(args.suite) as f:
+        for line in f:
+            fields = line.split('#')[0].split()
+            if not fields:
+                continue
+            name, function, budget = fields[0], fields[1], int(fields[2])
+            setup = [s[1:] for s in fields[3:] if s.startswith('@')]
+            settings = [s for s in fields[3:] if not s.startswith('@')]
+            cpu = newCpu(args)
+            loadFirmware(elf, cpu)
+            try:
+                cycles = run(elf, cpu, function, settings, setup)
+            except SimError as e:
+                print('{:24} {:28} ERROR {}'.format(name, function, e))
+                failed += 1
+                continue
+            ok = cycles <= budget
+            failed += not ok
+            print('{:24} {:28} {:8} / {:8} cycles {}'.format(name, function, cycles, budget, 'ok' if ok else 'OVER BUDGET'))
+    return failed
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Count Cortex-M0 cycles for functions in the firmware ELF')
+    parser.add_argument('elf')
+    parser.add_argument('function', nargs='?', help='function to run')
+    parser.add_argument('settings', nargs='*', help='NAME[:SIZE]=VALUE, r0..r3 for arguments')
+    parser.add_argument('--setup', action='append', default=[], help='functions to run first, not counted')
+    parser.add_argument('--suite', help='run every benchmark in this file instead')
+    parser.add_argument('--wait', type=int, default=1, help='flash wait states (1 above 24 MHz)')
+    parser.add_argument('--periph-wait', type=int, default=1, help='extra cycles for each peripheral access')
+    parser.add_argument('--no-prefetch', action='store_true', help='model the flash prefetch buffer as off')
+    parser.add_argument('--profile', action='store_true', help='break the cycles down by function')
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    if args.suite:
+        return 1 if runSuite(args, elf) else 0
+    if not args.function:
+        parser.error('give a function to run, or --suite')
+
+    cpu = newCpu(args)
+    loadFirmware(elf, cpu)
+    cpu.profile = {} if args.profile else None
+    cycles = run(elf, cpu, args.function, args.settings, args.setup)
+    print('{}: {} cycles, {} instructions, r0 = {:#x}'.format(args.function, cycles, cpu.instructions, cpu.r[0]))
+    if args.profile:
+        byFunction = {}
+        for pc, c in cpu.profile.items():
+            name = elf.nameAt(pc) or '{:#010x}'.format(pc)
+            byFunction[name] = byFunction.get(name, 0) + c
+        for name, c in sorted(byFunction.items(), key=lambda kv: -kv[1]):
+            print('  {:32} {:8}'.format(name, c))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,68 @@
+"""
+Build-time RAM map of the firmware, from its ELF: what each part of the 8K takes, the biggest objects in it, and for
+each video mode how much of the shared screen buffer the mode uses, so line buffers or a bigger mode can be sized
+against what's really left. How deep the stack and how big the heap get at run time comes from the board (inc/ram.h).
+"""
+
+import argparse
+import sys
+from elf import Elf, STT_FUNC
+from scanout import MODES, VIDEO_COLOR, VIDEO_FIELDS, VIDEO_MONO
+
+RAM_START = 0x20000000
+MODE_NAMES = {VIDEO_COLOR: 'color 80x60', VIDEO_MONO: 'mono 400x100', VIDEO_FIELDS: 'fields 80x120'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Summarise the RAM use of the firmware, and what each video mode leaves')
+    parser.add_argument('elf')
+    parser.add_argument('--top', type=int, default=10, help='biggest objects to list')
+    parser.add_argument('--min-free', type=int, default=256,
+                        help='bytes that have to be left between the static RAM and the top, for the stack and heap')
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    symbols = elf.symbols
+    sym = elf.symbol
+    top = sym('_estack')
+    total = top - RAM_START
+    ramFunc = sum(size for value, size, kind in symbols.values()
+                  if kind == STT_FUNC and sym('_sdata') <= value & ~1 < sym('_edata'))
+    parts = [
+        ('vector table', symbols['ramVectors'][1] if 'ramVectors' in symbols else 0, ''),
+        ('.data', sym('_edata') - sym('_sdata'), '{} of it code run from RAM'.format(ramFunc)),
+        ('.bss', sym('_ebss') - sym('_sbss'), ''),
+        ('.noinit', sym('_enoinit') - sym('_snoinit'), 'the screen buffer'),
+    ]
+    free = top - sym('end')
+
+    print('RAM {} bytes'.format(total))
+    for name, size, note in parts:
+        print('  {:14} {:5}  {:5.1f}%  {}'.format(name, size, 100 * size / total, note))
+    print('  {:14} {:5}  {:5.1f}%  shared by the heap and the stack (the linker reserves {} and {})'.format(
+        'free', free, 100 * free / total, sym('_Min_Heap_Size'), sym('_Min_Stack_Size')))
+
+    objects = sorted(((size, name) for name, (value, size, _) in symbols.items()
+                      if RAM_START <= value < top and size), reverse=True)
+    print('biggest objects')
+    for size, name in objects[:args.top]:
+        print('  {:24} {:5}'.format(name, size))
+
+    screen = symbols['screen'][1]
+    print('video modes')
+    for mode in sorted(MODES):
+        rows, stride = MODES[mode]
+        if mode == VIDEO_FIELDS:
+            rows //= 2  # the two fields take turns with the same rows
+        used = rows * stride
+        print('  {:14} {:5} of the {} byte screen buffer, {} spare at its end, {} with the free RAM'.format(
+            MODE_NAMES[mode], used, screen, screen - used, screen - used + free))
+
+    if free < args.min_free:
+        print('only {} bytes free, under the {} required'.format(free, args.min_free))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
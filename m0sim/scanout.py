@@ -0,0 +1,268 @@
+"""
+Off-target model of the scan-out: runs the firmware's own line and frame interrupts and its per-frame update in the
+simulator, a line at a time, and rebuilds the picture from the address the DMA is pointed at on every line.
+The pictures are checked against the golden PNGs written by imgconverter/pack.py --golden, and the frame update
+against the cycles the vblank leaves it.
+"""
+
+import argparse
+import glob
+import os
+import struct
+import sys
+import cv2 as cv
+import numpy as np
+from cpu import SimError
+from elf import Elf
+from main import EXCEPTION_CYCLES, PERIPHERALS, REGISTERS, loadFirmware, newCpu
+
+# timings, see inc/vga.h
+WIDTH = 80
+HEIGHT = 60
+LINE_CYCLES = 1056
+FRAME_LINES = 628
+FIRST_VISIBLE = 27  # 4 lines of sync and 23 of back porch
+VISIBLE_LINES = 600
+LINE_ISR_AT = 984  # TIM3 CCR3, after the last pixel of the line
+LINE_WINDOW = 256  # cycles the line interrupt has before the next line's pixels
+VBLANK_CYCLES = (FRAME_LINES - VISIBLE_LINES) * LINE_CYCLES
+
+# rows and bytes per row (including the edge) for each video mode
+VIDEO_COLOR = 0
+VIDEO_MONO = 1
+VIDEO_FIELDS = 2
+MODES = {VIDEO_COLOR: (HEIGHT, WIDTH + 1), VIDEO_MONO: (100, 51), VIDEO_FIELDS: (2 * HEIGHT, WIDTH + 1)}
+
+# must match inc/assets.h
+ASSET_MAGIC = 0x414d5453
+HEADER = struct.Struct('<II')
+ENTRY = struct.Struct('<HHHHBB2xIII')
+FORMAT_INDEXED = 0
+FORMAT_SCANOUT = 1
+FORMAT_MONO = 2
+FORMAT_FIELDS = 3
+
+# (bits, shift) of blue, green and red for each palette id, must match imgconverter/quantize.py
+PALETTES = {
+    0: ((2, 4), (2, 2), (2, 0)),  # BGR222
+    1: ((2, 0), (3, 2), (3, 5)),  # RGB332
+}
+
+
+def reg(periph: str, name: str):
+    kind = next(k for k in REGISTERS if periph.startswith(k))
+    return PERIPHERALS[periph] + REGISTERS[kind][name]
+
+
+TIM2_CNT = reg('TIM2', 'CNT')
+TIM15_DIER = reg('TIM15', 'DIER')
+DMA_CCR = reg('DMA1_Channel5', 'CCR')
+DMA_CMAR = reg('DMA1_Channel5', 'CMAR')
+
+
+def readAssets(elf: Elf, cpu):
+    base = elf.symbol('_sassets')
+    magic, count = HEADER.unpack(cpu.mem.read(base, HEADER.size)[0].to_bytes(HEADER.size, 'little'))
+    if magic != ASSET_MAGIC:
+        return []
+    raw = bytes(cpu.mem.read(base + HEADER.size + i, 1)[0] for i in range(ENTRY.size * count))
+    return [ENTRY.unpack_from(raw, i * ENTRY.size) for i in range(count)]
+
+
+# the pixels as the DAC shows them, in cv's blue green red order
+def toColor(pixels: np.ndarray, palette: int):
+    channels = []
+    for bits, shift in PALETTES[palette]:
+        top = 2 ** bits - 1
+        channels.append(np.rint(((pixels.astype(np.int32) >> shift) & top) * 255 / top))
+    return np.stack(channels, axis=-1).astype(np.uint8)
+
+
+# the picture a set of rows makes in the given mode, without the edge pixels. Mono pixels are white where the bit is set
+def toPicture(rows: np.ndarray, mode: int, palette: int):
+    if mode == VIDEO_MONO:
+        return np.repeat(np.unpackbits(rows[:, :-1], axis=1)[:, :, np.newaxis] * 255, 3, axis=2)
+    return toColor(rows[:, :-1], palette)
+
+
+class Scanout:
+    def __init__(self, elf: Elf, cpu):
+        self.elf = elf
+        self.cpu = cpu
+        self.mode = VIDEO_COLOR
+
+    def call(self, name: str, args=()):
+        return self.cpu.call(self.elf.symbol(name), args)
+
+    # what the DMA sends out on the line with the current settings, or None if it's idle
+    def linePixels(self):
+        mem = self.cpu.mem
+        if not (mem.periph.regs.get(DMA_CCR, 0) & 1 and mem.periph.regs.get(TIM15_DIER, 0) & (1 << 9)):
+            return None
+        addr = mem.periph.regs.get(DMA_CMAR, 0)
+        return bytes(mem.read(addr + i, 1)[0] for i in range(MODES[self.mode][1]))
+
+    def lineInterrupt(self, line: int):
+        self.cpu.mem.periph.write(TIM2_CNT, line * LINE_CYCLES + LINE_ISR_AT)
+        return self.call('TIM3_IRQHandler') + 2 * EXCEPTION_CYCLES
+
+    def frame(self):
+        """
+        One refresh. Gives back the lines the DMA put out in the visible region, the slowest line interrupt,
+        the slowest per-line main loop work, the cycles of the vblank interrupt and frame update at the end,
+        and the cycles the vblank had for them (what's left after the line interrupts that keep running through it)
+        """
+        lines = []
+        errors = []
+        lineCycles = []
+        lineWork = 0
+        update = 0
+        self.mode = self.cpu.mem.read(self.elf.symbol('videoMode'), 1)[0]
+        self.field = self.cpu.mem.read(self.elf.symbol('frameCount'), 4)[0] & 1
+        for line in range(FRAME_LINES):
+            pixels = self.linePixels()
+            if FIRST_VISIBLE <= line < FIRST_VISIBLE + VISIBLE_LINES:
+                lines.append(pixels)
+            elif pixels is not None:
+                errors.append('line {} is outside the visible region but is being scanned out'.format(line))
+            lineCycles.append(self.lineInterrupt(line))
+            # the main loop wakes up after every line interrupt
+            lineWork = max(lineWork, self.call('updateLine'))
+            if line == FIRST_VISIBLE + VISIBLE_LINES - 1:
+                # TIM2 fires at the start of the next line, and the main loop does the frame update straight after
+                self.cpu.mem.periph.write(TIM2_CNT, (line + 1) * LINE_CYCLES)
+                update = self.call('TIM2_IRQHandler') + 2 * EXCEPTION_CYCLES + self.call('updateFrame')
+        vblankLines = lineCycles[FIRST_VISIBLE + VISIBLE_LINES:] + lineCycles[:FIRST_VISIBLE]
+        return lines, errors, max(lineCycles), lineWork, update, VBLANK_CYCLES - sum(vblankLines)
+
+
+def collapseRows(lines, mode: int, field: int):
+    """
+    Each framebuffer row is scanned out for several lines in a row. Give back the rows, which of them this frame
+    shows, and a message for every line that's blank or doesn't match the rest of its row (a row starting a line early
+    or late, or tearing). In field mode the rows of the other field have to be blank
+    """
+    count, stride = MODES[mode]
+    rowLines = VISIBLE_LINES // count
+    rows = np.zeros((count, stride), np.uint8)
+    shown = np.ones(count, bool)
+    if mode == VIDEO_FIELDS:
+        shown[1 - field::2] = False
+    errors = []
+    for y in range(count):
+        block = lines[y * rowLines:(y + 1) * rowLines]
+        first = block[0]
+        if not shown[y]:
+            if any(pixels is not None for pixels in block):
+                errors.append('row {} is from the other field but is being scanned out'.format(y))
+            continue
+        for i, pixels in enumerate(block):
+            if pixels is None:
+                errors.append('line {} (row {}) is blank'.format(FIRST_VISIBLE + y * rowLines + i, y))
+            elif pixels != first:
+                errors.append('line {} differs from the rest of row {}'.format(FIRST_VISIBLE + y * rowLines + i, y))
+        if first is not None:
+            rows[y] = np.frombuffer(first, np.uint8)
+    return rows, shown, errors
+
+
+# compare the rows a frame showed with the golden image
+def compareGolden(rows: np.ndarray, shown: np.ndarray, picture: np.ndarray, golden: np.ndarray):
+    errors = []
+    if rows[:, -1].any():
+        errors.append('edge pixel not black on rows {}'.format(list(np.nonzero(rows[:, -1])[0])))
+    if picture.shape != golden.shape:
+        return errors + ['scanned out {}x{} but the golden image is {}x{}'.format(
+            picture.shape[1], picture.shape[0], golden.shape[1], golden.shape[0])]
+    diff = np.nonzero((picture != golden).any(axis=-1) & shown[:, np.newaxis])
+    if len(diff[0]):
+        errors.append('{} pixels differ from the golden image, first at row {} column {}'.format(
+            len(diff[0]), diff[0][0], diff[1][0]))
+    return errors
+
+
+def findGolden(directory: str, assetId: int, frame: int):
+    paths = glob.glob(os.path.join(directory, '{:02}-*-{}.png'.format(assetId, frame)))
+    return cv.imread(paths[0]) if paths else None
+
+
+def checkAsset(args, elf: Elf, entry):
+    assetId, width, height, frames, fmt, palette = entry[:6]
+    cpu = newCpu(args)
+    loadFirmware(elf, cpu)
+    model = Scanout(elf, cpu)
+    model.call('setupHorizontalTimers')
+    model.call('setupVerticalTimer')
+    model.call('showAsset', [assetId])
+
+    failed = 0
+    # the first refresh shows whatever was on screen before the first vblank, so it isn't checked
+    for n in range(args.frames + 1):
+        lines, errors, lineMax, lineWork, update, budget = model.frame()
+        if n == 0:
+            continue
+        # scan-out frames are dithered between by the vblank interrupt, indexed images are copied in once a frame, and
+        # VQ and packed clips only show their first frame until they're played
+        shown = n & 1 if fmt in (FORMAT_SCANOUT, FORMAT_MONO) and frames > 1 else 0
+        rows, shownRows, rowErrors = collapseRows(lines, model.mode, model.field)
+        errors += rowErrors
+        picture = toPicture(rows, model.mode, palette)
+        golden = findGolden(args.golden, assetId, shown)
+        if golden is None:
+            errors.append('no golden image for frame {}'.format(shown))
+        else:
+            errors += compareGolden(rows, shownRows, picture, golden)
+        if lineMax > LINE_WINDOW:
+            errors.append('line interrupt took {} cycles, over the {} cycle window'.format(lineMax, LINE_WINDOW))
+        if lineWork > LINE_CYCLES:
+            errors.append('the main loop took {} cycles after a line, so it falls behind the beam'.format(lineWork))
+        if update > budget:
+            errors.append('frame update took {} cycles, over the {} the vblank leaves'.format(update, budget))
+        if args.out:
+            os.makedirs(args.out, exist_ok=True)
+            cv.imwrite(os.path.join(args.out, '{:02}-{}.png'.format(assetId, n)), picture)
+
+        print('asset {:2} frame {}: update {:6} / {:6} cycles, line isr {:4} / {:4}, line work {:4}  {}'.format(
+            assetId, n, update, budget, lineMax, LINE_WINDOW, lineWork, 'ok' if not errors else 'FAIL'))
+        for e in errors[:args.max_errors]:
+            print('    ' + e)
+        if len(errors) > args.max_errors:
+            print('    ... and {} more'.format(len(errors) - args.max_errors))
+        failed += bool(errors)
+    return failed
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Simulate the scan-out of every asset and check it against the golden images')
+    parser.add_argument('elf')
+    parser.add_argument('--golden', default='golden', help='directory of PNGs written by imgconverter/pack.py --golden')
+    parser.add_argument('--asset', type=int, action='append', help='only check these asset ids')
+    parser.add_argument('--frames', type=int, default=2, help='refreshes to check for each asset')
+    parser.add_argument('--out', help='write what was scanned out here, as PNGs')
+    parser.add_argument('--max-errors', type=int, default=5, help='problems to list for each frame')
+    parser.add_argument('--wait', type=int, default=1, help='flash wait states (1 above 24 MHz)')
+    parser.add_argument('--periph-wait', type=int, default=1, help='extra cycles for each peripheral access')
+    parser.add_argument('--no-prefetch', action='store_true', help='model the flash prefetch buffer as off')
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    cpu = newCpu(args)
+    loadFirmware(elf, cpu)
+    entries = [e for e in readAssets(elf, cpu) if not args.asset or e[0] in args.asset]
+    if not entries:
+        print('no assets to check')
+        return 1
+
+    failed = 0
+    for entry in entries:
+        try:
+            failed += checkAsset(args, elf, entry)
+        except SimError as e:
+            print('asset {:2}: ERROR {}'.format(entry[0], e))
+            failed += 1
+    print('{} frames failed'.format(failed) if failed else 'all frames match')
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
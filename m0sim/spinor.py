@@ -0,0 +1,192 @@
+"""
+Off-target check of the SPI NOR flash video (src/spiflash.c and src/stream.c): a 25-series flash on SPI2, holding an
+image from imgconverter/norpack.py, answers the firmware's commands in the simulator. It checks the part is found,
+that streamOpen accepts the image, and that the first frame is read into the screen buffer by DMA and revealed, and
+gives the cycles the CPU spends on each step against what the transfer itself takes on the SPI bus.
+"""
+
+import argparse
+import struct
+import sys
+from cpu import SimError
+from elf import Elf
+from main import EXCEPTION_CYCLES, loadFirmware, newCpu
+from scanout import HEIGHT, WIDTH, reg
+
+# must match inc/spiflash.h and inc/stream.h
+CMD_READ = 0x03
+CMD_RELEASE = 0xAB
+CMD_JEDEC_ID = 0x9F
+STREAM_MAGIC = 0x564d5453
+STREAM_HEADER = struct.Struct('<IIHBBI')
+
+CS_PIN = 1 << 12
+SPI_CR1_SPE = 1 << 6
+SPI_CR1_RXONLY = 1 << 10
+SPI_CR2_RXDMAEN = 1 << 0
+SPI_SR_RXNE_TXE = 0x3  # and never busy, with nothing left in the receive FIFO
+DMA_CCR_EN = 1 << 0
+DMA_ISR_TCIF4 = 1 << 13
+BYTE_CYCLES = 16  # a byte at PCLK / 2
+
+SPI2_CR1 = reg('SPI2', 'CR1')
+SPI2_SR = reg('SPI2', 'SR')
+SPI2_DR = reg('SPI2', 'DR')
+GPIOB_BSRR = reg('GPIOB', 'BSRR')
+GPIOB_BRR = reg('GPIOB', 'BRR')
+DMA_ISR = reg('DMA1', 'ISR')
+DMA_IFCR = reg('DMA1', 'IFCR')
+CH4_CCR = reg('DMA1_Channel4', 'CCR')
+CH4_CNDTR = reg('DMA1_Channel4', 'CNDTR')
+CH4_CMAR = reg('DMA1_Channel4', 'CMAR')
+SPI2_CR2 = reg('SPI2', 'CR2')
+
+
+class SpiNor:
+    """
+    The flash part behind SPI2, with CS on PB12. A byte written to the data register is clocked out and the one the part
+    sends back is what the next read of it gets. Once SPI2 is enabled in receive-only mode with channel 4 set up, the
+    whole DMA transfer happens at once: the bytes land in memory, channel 4's transfer complete flag is set, and
+    busyCycles grows by the time it would have taken on the bus
+    """
+
+    def __init__(self, cpu, image: bytes, jedecId=0xEF4018):
+        self.mem = cpu.mem
+        self.periph = cpu.mem.periph
+        self.image = image
+        self.jedecId = jedecId
+        self.selected = False
+        self.command = []
+        self.addr = 0
+        self.received = 0xFF
+        self.busyCycles = 0
+        self.periph.forced[SPI2_SR] = SPI_SR_RXNE_TXE
+        self.periph.readHooks[SPI2_DR] = lambda: self.received
+        self.periph.writeHooks[SPI2_DR] = self.exchange
+        self.periph.writeHooks[SPI2_CR1] = self.control
+        self.periph.writeHooks[GPIOB_BSRR] = self.setReset
+        self.periph.writeHooks[GPIOB_BRR] = lambda value: self.setReset((value & CS_PIN) << 16)
+        self.periph.writeHooks[DMA_IFCR] = lambda value: self.periph.regs.update({DMA_ISR: self.periph.regs.get(DMA_ISR, 0) & ~value})
+
+    def setReset(self, value: int):
+        if value & (CS_PIN << 16):
+            self.chipSelect(False)
+        if value & CS_PIN:
+            self.chipSelect(True)
+
+    def chipSelect(self, high: bool):
+        if high:
+            self.selected = False
+        elif not self.selected:
+            self.selected = True
+            self.command = []
+
+    def data(self):
+        value = self.image[self.addr] if self.addr < len(self.image) else 0xFF  # erased past the end
+        self.addr += 1
+        return value
+
+    def respond(self):
+        # what the part shifts out while the next byte goes in
+        if not self.selected or not self.command:
+            return 0xFF
+        cmd = self.command[0]
+        if cmd == CMD_JEDEC_ID and 1 < len(self.command) <= 4:
+            return (self.jedecId >> (8 * (4 - len(self.command)))) & 0xFF
+        if cmd == CMD_READ and len(self.command) > 4:
+            return self.data()
+        return 0xFF
+
+    def exchange(self, value: int):
+        self.busyCycles += BYTE_CYCLES
+        if not self.selected:
+            self.received = 0xFF
+            return
+        self.command.append(value & 0xFF)
+        if self.command[0] == CMD_READ and len(self.command) == 4:
+            self.addr = (self.command[1] << 16) | (self.command[2] << 8) | self.command[3]
+        self.received = self.respond()
+
+    def control(self, value: int):
+        dma = self.periph.regs.get(CH4_CCR, 0) & DMA_CCR_EN and self.periph.regs.get(SPI2_CR2, 0) & SPI_CR2_RXDMAEN
+        if not (value & SPI_CR1_SPE and value & SPI_CR1_RXONLY and dma):
+            return
+        if not self.selected or not self.command or self.command[0] != CMD_READ or len(self.command) < 4:
+            raise SimError('SPI2 receiving by DMA outside a read command')
+        count = self.periph.regs.get(CH4_CNDTR, 0)
+        if not count:
+            return
+        dest = self.periph.regs.get(CH4_CMAR, 0)
+        self.mem.load(dest, bytes(self.data() for _ in range(count)))
+        self.periph.regs[CH4_CNDTR] = 0
+        self.periph.regs[DMA_ISR] = self.periph.regs.get(DMA_ISR, 0) | DMA_ISR_TCIF4
+        self.busyCycles += count * BYTE_CYCLES
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Check the SPI flash video player against a flash image in the simulator')
+    parser.add_argument('elf', help='firmware built with NOR defined')
+    parser.add_argument('image', help='the flash image from imgconverter/norpack.py')
+    parser.add_argument('--wait', type=int, default=1, help='flash wait states (1 above 24 MHz)')
+    parser.add_argument('--periph-wait', type=int, default=1, help='extra cycles for each peripheral access')
+    parser.add_argument('--no-prefetch', action='store_true', help='model the flash prefetch buffer as off')
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    with open(args.image, 'rb') as f:
+        image = f.read()
+    magic, frames, frameSize, _, _, dataOffset = STREAM_HEADER.unpack_from(image)
+    if magic != STREAM_MAGIC:
+        print('{} isn\'t a norpack.py image'.format(args.image))
+        return 1
+
+    cpu = newCpu(args)
+    loadFirmware(elf, cpu)
+    nor = SpiNor(cpu, image)
+    failed = 0
+
+    def step(name, function, argv=(), irq=False):
+        before = nor.busyCycles
+        cycles = cpu.call(elf.symbol(function) & ~1, argv) + (2 * EXCEPTION_CYCLES if irq else 0)
+        print('{:28} {:8} cycles, {:8} on the bus'.format(name, cycles, nor.busyCycles - before))
+        return cpu.r[0]
+
+    def finishDma():
+        if cpu.mem.periph.regs.get(DMA_ISR, 0) & DMA_ISR_TCIF4:
+            step('  transfer complete', 'DMA1_Channel4_5_IRQHandler', irq=True)
+
+    try:
+        jedec = step('spiFlashInit', 'spiFlashInit')
+        if jedec != nor.jedecId:
+            print('  read JEDEC ID {:#08x}, not {:#08x}'.format(jedec, nor.jedecId))
+            failed += 1
+        opened = step('streamOpen', 'streamOpen', [0])
+        if opened != frames:
+            print('  streamOpen found {} frames, the image has {} (made for this DAC?)'.format(opened, frames))
+            return 1
+        step('streamStart', 'streamStart', [0])
+        # the screen buffer isn't on screen yet, so the whole first frame is read in one go
+        step('streamLine', 'streamLine')
+        finishDma()
+        cpu.mem.write(elf.symbol('frameCount'), 4, 1)
+        step('streamUpdate', 'streamUpdate')
+        finishDma()
+    except SimError as e:
+        print('ERROR {}'.format(e))
+        return 1
+
+    screen = elf.symbol('screen')
+    shown, _ = cpu.mem.read(elf.symbol('frame'), 4)
+    if shown != screen:
+        print('frame isn\'t the screen buffer after the first frame was due')
+        failed += 1
+    got = bytes(cpu.mem.read(screen + i, 1)[0] for i in range(HEIGHT * (WIDTH + 1)))
+    if got != image[dataOffset:dataOffset + frameSize]:
+        print('the screen buffer doesn\'t hold the first frame')
+        failed += 1
+    print('{} frames of {} bytes, first frame {}'.format(frames, frameSize, 'ok' if not failed else 'WRONG'))
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,141 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "adc.h"
+
+const uint16_t * volatile adcLatest = 0;
+volatile unsigned int adcFrame = 0;
+
+// the DMA fills one half while the other is the published set
+static uint16_t buffers[2][ADC_MAX_CHANNELS << ADC_MAX_SHIFT];
+static int filling = 0;
+static uint32_t adcChannels = 0;
+static int adcChannelCount = 0;
+static uint8_t adcShift = 0;
+
+/*
+ * Point the DMA at the half that isn't published and arm the ADC for the next vblank
+ * The ADC has to be stopped for this: its one-shot DMA mode stops asking once the count runs out, and only starts
+ * again when DMAEN is set again, which can only be done while it isn't converting
+ */
+RAMFUNC static void armScan() {
+	DMA1_Channel1->CCR &= ~DMA_CCR_EN;
+	DMA1_Channel1->CMAR = (uint32_t) buffers[filling];
+	DMA1_Channel1->CNDTR = adcChannelCount << adcShift;
+	DMA1_Channel1->CCR |= DMA_CCR_EN;
+
+	ADC1->ISR = ADC_ISR_OVR | ADC_ISR_EOSEQ | ADC_ISR_EOC;
+	ADC1->CFGR1 &= ~ADC_CFGR1_DMAEN;
+	ADC1->CFGR1 |= ADC_CFGR1_DMAEN;
+	ADC1->CR |= ADC_CR_ADSTART; // with a hardware trigger this waits for it
+}
+
+/*
+ * Start sampling the channels (ADC_CHANNEL bits, at most ADC_MAX_CHANNELS of them) every vblank, averaging 1 << shift
+ * scans of them. TIM2 has to be set up already (see setupVerticalTimer), and the pins are switched to analog here.
+ * At PCLK / 4 a conversion is 6.8 us, or 25.2 us for the internal channels which need a longer sampling time, and the
+ * scans should be done in the 28 lines (740 us) of the vblank: the DMA only moves a half-word per conversion, but it
+ * would be sharing the bus with the pixels
+ */
+void adcInit(uint32_t channels, uint8_t shift) {
+	RCC->AHBENR |= RCC_AHBENR_GPIOAEN | RCC_AHBENR_GPIOBEN | RCC_AHBENR_GPIOCEN | RCC_AHBENR_DMA1EN;
+	RCC->APB2ENR |= RCC_APB2ENR_ADC1EN;
+
+	adcChannelCount = 0;
+	for(int n = 0; n < 18; n++) {
+		if(!(channels & ADC_CHANNEL(n)))
+			continue;
+		if(adcChannelCount == ADC_MAX_CHANNELS) { // no room in the buffer for any more
+			channels &= ~ADC_CHANNEL(n);
+			continue;
+		}
+		adcChannelCount++;
+		if(n < 8)
+			GPIOA->MODER |= 0x3 << (2 * n);
+		else if(n < 10)
+			GPIOB->MODER |= 0x3 << (2 * (n - 8));
+		else if(n < 16)
+			GPIOC->MODER |= 0x3 << (2 * (n - 10));
+	}
+	adcChannels = channels;
+	adcShift = shift > ADC_MAX_SHIFT ? ADC_MAX_SHIFT : shift;
+	adcLatest = 0;
+	filling = 0;
+
+	// clocked from PCLK / 4 (10 MHz) rather than the 14 MHz oscillator, so the trigger to sample time never jitters.
+	// Calibrate first, which has to be done with it disabled
+	ADC1->CFGR2 = ADC_CFGR2_JITOFFDIV4;
+	ADC1->CR = ADC_CR_ADCAL;
+	while(ADC1->CR & ADC_CR_ADCAL);
+	if(channels & (ADC_TEMPERATURE | ADC_VREFINT))
+		ADC->CCR |= (channels & ADC_TEMPERATURE ? ADC_CCR_TSEN : 0) | (channels & ADC_VREFINT ? ADC_CCR_VREFEN : 0);
+	ADC1->CR = ADC_CR_ADEN;
+	while(!(ADC1->ISR & ADC_ISR_ADRDY));
+
+	ADC1->CHSELR = channels;
+	ADC1->SMPR = channels & (ADC_TEMPERATURE | ADC_VREFINT) ? 0x7 : 0x5; // 239.5 or 55.5 ADC clocks, enough for a 10k pot
+	ADC1->CFGR1 =
+			ADC_CFGR1_EXTEN_0 |   // start on a rising edge of the trigger
+			ADC_CFGR1_EXTSEL_1 |  // TRG2, TIM2_TRGO
+			(adcShift ? ADC_CFGR1_CONT : 0) | // keep scanning until the DMA has them all
+			ADC_CFGR1_DMAEN;      // one-shot DMA mode
+
+	// channel 1 takes the ADC's requests. Half-words from the data register into the buffer, at the lowest priority
+	DMA1_Channel1->CCR = 0;
+	DMA1_Channel1->CPAR = (uint32_t) &(ADC1->DR);
+	DMA1_Channel1->CCR =
+			DMA_CCR_MSIZE_0 | // 16 bit memory
+			DMA_CCR_PSIZE_0 | // 16 bit peripheral
+			DMA_CCR_MINC |    // increment memory address
+			DMA_CCR_TCIE;     // interrupt when the set is done
+	NVIC->ISER[0] |= 1 << DMA1_Channel1_IRQn;
+	NVIC_SetPriority(DMA1_Channel1_IRQn, 3); // lowest priority, it must never hold off the line interrupt
+	armScan();
+
+	// TRGO follows OC3REF, which PWM mode 2 makes go high when the count reaches CCR3 at the start of the vblank
+	TIM2->CCMR2 = (TIM2->CCMR2 & ~TIM_CCMR2_OC3M) | (0x7 << 4);
+	TIM2->CR2 = (TIM2->CR2 & ~TIM_CR2_MMS) | (0x6 << 4);
+}
+
+/*
+ * A scan (or all of the oversampling scans) is in the buffer: start filling the other half, and average this one
+ * into its first entries before publishing it
+ * It fires early in the vblank, which is when the flash writer erases pages, so it runs from RAM (and armScan with it):
+ * a fetch from flash would stall the bus, and the line interrupt, until the erase was done
+ */
+RAMFUNC void DMA1_Channel1_IRQHandler() {
+	DMA1->IFCR = DMA_IFCR_CGIF1;
+
+	// in continuous mode the ADC carries on converting after the DMA stops taking them. Stopping takes a few ADC clocks
+	ADC1->CR |= ADC_CR_ADSTP;
+	while(ADC1->CR & ADC_CR_ADSTP);
+
+	uint16_t *done = buffers[filling];
+	filling = !filling;
+	armScan();
+
+	if(adcShift) {
+		// the samples go channel by channel, scan after scan, so a channel's sum only reads entries at or after its own
+		int total = adcChannelCount << adcShift;
+		for(int c = 0; c < adcChannelCount; c++) {
+			uint32_t sum = 0;
+			for(int i = c; i < total; i += adcChannelCount)
+				sum += done[i];
+			done[c] = (sum + (1 << (adcShift - 1))) >> adcShift;
+		}
+	}
+	adcLatest = done;
+	adcFrame = frameCount;
+}
+
+/*
+ * the newest reading of an ADC channel number (0..17), or -1 if it isn't being sampled or there hasn't been a set yet
+ */
+int adcRead(int channel) {
+	const uint16_t *latest = adcLatest;
+	if(!latest || !(adcChannels & ADC_CHANNEL(channel)))
+		return -1;
+	int index = 0;
+	for(int n = 0; n < channel; n++)
+		index += (adcChannels >> n) & 1;
+	return latest[index];
+}
@@ -0,0 +1,184 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "assets.h"
+#include "vq.h"
+#include "packed.h"
+#include "anim.h"
+
+// rows to copy each time the main loop wakes when the screen buffer isn't on screen, so a copy doesn't hold it up long
+#define FREE_ROWS 8
+
+uint32_t animShown = 0;
+uint32_t animLate = 0;
+uint32_t animDropped = 0;
+
+static const animFrame *sequence;
+static int sequenceLen;
+static char looping;
+static char active = 0;
+
+static int current;                // the image being loaded, or the one on screen once it's been revealed
+static int subFrame;               // which of its frames, for clips
+static char pending = 0;           // the image at current is still to be revealed
+static unsigned int due;           // the frame the image at current is meant to be first shown in
+static unsigned int target;        // the frame it will be: due, or the next one if that's gone
+static const assetEntry *loading;  // the image at current
+static int loadRow;                // rows of it copied so far
+
+// whether an asset can be played: a colour picture the size of the screen (see assetValid), in a layout that needs no
+// conversion
+static int playable(const assetEntry *asset) {
+	if(!asset || asset->palette != PALETTE)
+		return 0;
+	if(asset->format != ASSET_FORMAT_INDEXED && asset->format != ASSET_FORMAT_SCANOUT &&
+			asset->format != ASSET_FORMAT_VQ && asset->format != ASSET_FORMAT_PACKED)
+		return 0;
+	return assetCheck(asset);
+}
+
+// indexed, VQ and packed clips play every frame in turn, scan-out assets only have the one picture (two are a dither pair)
+static int clipFrames(const assetEntry *asset) {
+	return asset->format == ASSET_FORMAT_SCANOUT ? 1 : asset->frames;
+}
+
+// whether the image has to be loaded into the screen buffer
+static int loaded(const assetEntry *asset) {
+	return asset->format == ASSET_FORMAT_INDEXED || asset->format == ASSET_FORMAT_VQ || asset->format == ASSET_FORMAT_PACKED;
+}
+
+static void copyRows(int last) {
+	if(loading->format == ASSET_FORMAT_VQ) {
+		const vqHeader *vq = (const vqHeader *) assetData(loading);
+		// a whole row of blocks at a time, so up to the last one the beam has finished all of
+		loadRow = vqDecodeRows(vq, vqFrame(loading, subFrame), loadRow, last);
+		return;
+	}
+	if(loading->format == ASSET_FORMAT_PACKED) {
+		const packedHeader *packed = (const packedHeader *) assetData(loading);
+		loadRow = packedDecodeRows(packed, packedFrame(loading, subFrame), loadRow, last);
+		return;
+	}
+	const char *pixels = assetData(loading) + subFrame * WIDTH * HEIGHT;
+	for(; loadRow < last; loadRow++) {
+		for(int x = 0; x < WIDTH; x++)
+			screen.color[loadRow][x] = pixels[loadRow * WIDTH + x];
+	}
+}
+
+/*
+ * Move on to the next image to load (the next frame of a clip, or the next asset), skipping any whose time will be
+ * over before they could be shown
+ */
+static void next(unsigned int now) {
+	for(;;) {
+		if(current >= 0) {
+			due += sequence[current].frames;
+			subFrame++;
+		}
+		if(current < 0 || subFrame >= clipFrames(loading)) {
+			if(++current == sequenceLen) {
+				if(!looping) // the last picture stays up
+					return;
+				current = 0;
+			}
+			loading = assetFind(sequence[current].asset);
+			subFrame = 0;
+		}
+		// the earliest it can be shown is the next frame
+		if((int) (due + sequence[current].frames - (now + 1)) > 0)
+			break;
+		animDropped++;
+	}
+	target = (int) (due - (now + 1)) > 0 ? due : now + 1;
+	loadRow = 0;
+	pending = 1;
+}
+
+/*
+ * Start playing, with the video in colour mode. The first image is due on the next frame. The assets are all checked
+ * first (it takes a few ms), and it returns 0 without starting if one of them can't be played
+ * The sequence is read as it plays, so it has to stay put until animStop
+ */
+int animStart(const animFrame *frames, int count, int loop) {
+	animStop();
+	if(count <= 0)
+		return 0;
+	for(int i = 0; i < count; i++) {
+		if(!frames[i].frames || !playable(assetFind(frames[i].asset)))
+			return 0;
+	}
+	sequence = frames;
+	sequenceLen = count;
+	looping = loop;
+	current = -1;
+	due = frameCount + 1;
+	active = 1;
+	next(frameCount);
+	return 1;
+}
+
+/*
+ * Stop playing and leave the picture on screen. If it's a scan-out image it's copied into the screen buffer, so the
+ * asset region isn't read any more
+ */
+void animStop() {
+	if(!active)
+		return;
+	active = 0;
+	pending = 0;
+	const char *shown = frame;
+	if(shown && shown != screen.color[0]) {
+		char *copy = screen.color[0];
+		for(int i = 0; i < HEIGHT * (WIDTH + 1); i++)
+			copy[i] = shown[i];
+		frame = copy;
+	}
+}
+
+int animActive() {
+	return active;
+}
+
+/*
+ * Call every time the main loop wakes up. Copies rows of the image being loaded, behind the beam if the screen buffer
+ * is on screen
+ */
+void animLine() {
+	if(!pending || !loaded(loading))
+		return;
+	if(frame != screen.color[0]) {
+		copyRows(loadRow + FREE_ROWS < HEIGHT ? loadRow + FREE_ROWS : HEIGHT);
+	} else if(frameCount + 1 == target) {
+		copyRows(rowsDone());
+	}
+}
+
+/*
+ * Call in the frame update: reveals the image due on this frame, and picks the next one to load
+ */
+void animUpdate() {
+	if(!active)
+		return;
+	unsigned int now = frameCount;
+	if(!pending || (int) (target - now) > 0)
+		return;
+	// if its time went by while it waited (the main loop was held up), skip to the one that's due now
+	if((int) (due + sequence[current].frames - now) <= 0) {
+		animDropped++;
+		pending = 0;
+		next(now - 1);
+	}
+	if(pending && (int) (target - now) <= 0) {
+		if(loaded(loading)) {
+			copyRows(HEIGHT); // the rows at the bottom the beam has only just finished with, or all of them if it's late
+			frame = screen.color[0];
+		} else {
+			frame = assetData(loading);
+		}
+		pending = 0;
+		animShown++;
+		if((int) (now - due) > 0 || !vblankCyclesLeft()) // a frame behind, or revealed part way down this one
+			animLate++;
+		next(now);
+	}
+}
@@ -0,0 +1,96 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "assets.h"
+#include "vq.h"
+#include "packed.h"
+
+// start and end of the ASSETS region, defined in the linker script
+extern const assetIndex _sassets;
+extern const char _eassetregion[];
+
+static uint32_t regionSize() {
+	return _eassetregion - (const char *) &_sassets;
+}
+
+// entries in the index, 0 if the region is empty (or erased) or the count would run the index off the end of it
+static uint32_t entryCount() {
+	if(_sassets.magic != ASSET_MAGIC || _sassets.count > (regionSize() - sizeof(assetIndex)) / sizeof(assetEntry))
+		return 0;
+	return _sassets.count;
+}
+
+/*
+ * look up an asset by id, returns 0 if the region is empty (or erased) or doesn't have it
+ */
+const assetEntry *assetFind(uint16_t id) {
+	uint32_t count = entryCount();
+	for(uint32_t i = 0; i < count; i++) {
+		if(_sassets.entries[i].id == id)
+			return &_sassets.entries[i];
+	}
+	return 0;
+}
+
+/*
+ * the index's entries in order, for listing them: returns 0 past the last one
+ */
+const assetEntry *assetAt(uint32_t i) {
+	if(i >= entryCount())
+		return 0;
+	return &_sassets.entries[i];
+}
+
+/*
+ * whether an asset's data is word aligned and inside the region after the index, so it can be read at all
+ */
+int assetInRegion(const assetEntry *asset) {
+	uint32_t size = regionSize();
+	uint32_t start = sizeof(assetIndex) + entryCount() * sizeof(assetEntry);
+	// the region is a whole number of words, so the padding after the data fits too
+	return asset && (asset->offset & 3) == 0 && asset->offset >= start && asset->offset <= size &&
+			asset->length <= size - asset->offset;
+}
+
+/*
+ * whether an asset is in the region and has the geometry and length its format needs to be shown on this screen,
+ * so nothing that shows it reads past its end. The CRC is checked by assetCheck
+ */
+int assetValid(const assetEntry *asset) {
+	if(!assetInRegion(asset) || !asset->frames)
+		return 0;
+	uint32_t frames = asset->frames;
+	if(asset->format == ASSET_FORMAT_INDEXED)
+		return asset->width == WIDTH && asset->height == HEIGHT && asset->length == frames * WIDTH * HEIGHT;
+	if(asset->format == ASSET_FORMAT_SCANOUT) // the rows carry the zero edge pixel
+		return asset->width == WIDTH + 1 && asset->height == HEIGHT && asset->length == frames * (WIDTH + 1) * HEIGHT;
+	if(asset->format == ASSET_FORMAT_MONO)
+		return asset->width == MONO_WIDTH && asset->height == MONO_HEIGHT && asset->length == frames * MONO_STRIDE * MONO_HEIGHT;
+	if(asset->format == ASSET_FORMAT_FIELDS)
+		return asset->width == WIDTH && asset->height == 2 * HEIGHT && asset->length == frames * WIDTH * 2 * HEIGHT;
+	if(asset->format == ASSET_FORMAT_VQ)
+		return vqValid(asset);
+	if(asset->format == ASSET_FORMAT_PACKED)
+		return packedValid(asset);
+	return 0;
+}
+
+const char *assetData(const assetEntry *asset) {
+	return (const char *) &_sassets + asset->offset;
+}
+
+/*
+ * check the asset is valid (see assetValid) and matches its CRC, using the hardware CRC unit
+ * it takes a word per clock cycle, so even a full frame only takes a few thousand cycles
+ */
+int assetCheck(const assetEntry *asset) {
+	if(!assetValid(asset))
+		return 0;
+	const uint32_t *data = (const uint32_t *) assetData(asset);
+	uint32_t words = (asset->length + 3) / 4;
+
+	RCC->AHBENR |= RCC_AHBENR_CRCEN;
+	CRC->CR = CRC_CR_RESET; // back to the initial value, no reversal
+	for(uint32_t i = 0; i < words; i++)
+		CRC->DR = data[i];
+	return CRC->DR == asset->crc;
+}
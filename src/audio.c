@@ -0,0 +1,141 @@
+#include "stm32f0xx.h"
+#include "audio.h"
+
+const int8_t audioSine[AUDIO_TABLE_LENGTH] = {
+	0, 12, 25, 37, 49, 60, 71, 81, 90, 98, 106, 112, 117, 122, 125, 126,
+	127, 126, 125, 122, 117, 112, 106, 98, 90, 81, 71, 60, 49, 37, 25, 12,
+	0, -12, -25, -37, -49, -60, -71, -81, -90, -98, -106, -112, -117, -122, -125, -126,
+	-127, -126, -125, -122, -117, -112, -106, -98, -90, -81, -71, -60, -49, -37, -25, -12,
+};
+
+const int8_t audioSquare[AUDIO_TABLE_LENGTH] = {
+	96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+	96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+	-96, -96, -96, -96, -96, -96, -96, -96, -96, -96, -96, -96, -96, -96, -96, -96,
+	-96, -96, -96, -96, -96, -96, -96, -96, -96, -96, -96, -96, -96, -96, -96, -96,
+};
+
+typedef struct {
+	const int8_t *samples; // 0 when the voice is off
+	uint32_t end;   // length << 16
+	uint32_t phase; // position in samples, 16.16 fixed point
+	uint32_t step;  // samples to move on per output sample, 16.16
+	uint32_t left;  // output samples until it stops, 0 to play until the end (or forever if it loops)
+	uint8_t volume; // 255 is full scale
+	uint8_t loop;
+} audioVoice;
+
+static audioVoice voices[AUDIO_VOICES];
+
+// unsigned samples, 128 is silence. The DMA reads it round and round, audioFill writes in behind it
+static uint8_t ring[AUDIO_RING];
+static int writePos = 0;
+
+/*
+ * Set up the DAC on PA4 and the DMA that feeds it. TIM3 has to be set up already (see setupHorizontalTimers)
+ */
+void audioInit() {
+	RCC->AHBENR |= RCC_AHBENR_GPIOAEN | RCC_AHBENR_DMA1EN;
+	RCC->APB1ENR |= RCC_APB1ENR_DACEN;
+
+	for(int i = 0; i < AUDIO_RING; i++)
+		ring[i] = 128;
+	writePos = 0;
+
+	GPIOA->MODER |= 0x3 << (2 * 4); // A4 analog, so the pin doesn't fight the DAC
+
+	// no trigger: the DAC converts a cycle after the DMA writes the holding register. The output buffer stays on
+	// so it can drive an amplifier input
+	DAC->CR = DAC_CR_EN1;
+	DAC->DHR8R1 = 128;
+
+	// channel 3 takes TIM3's update requests. Bytes from the ring into the 8 bit holding register, round and round,
+	// at the lowest priority so the pixels always go first (they never want the bus at the same time anyway)
+	DMA1_Channel3->CCR = 0;
+	DMA1_Channel3->CPAR = (uint32_t) &(DAC->DHR8R1);
+	DMA1_Channel3->CMAR = (uint32_t) ring;
+	DMA1_Channel3->CNDTR = AUDIO_RING;
+	DMA1_Channel3->CCR =
+			DMA_CCR_PSIZE_1 | // the DAC registers are words, the ring is bytes
+			DMA_CCR_MINC |    // increment memory address
+			DMA_CCR_CIRC |    // enable circular mode
+			DMA_CCR_DIR |     // transfer memory -> peripheral
+			DMA_CCR_EN;
+
+	// TIM3 updates when a line starts (or when genlock resets it for one), in the hsync
+	TIM3->DIER |= TIM_DIER_UDE;
+}
+
+/*
+ * Start playing samples on a voice, replacing whatever it was playing
+ * step is how far to move through the samples per output sample in 16.16 fixed point, so 1 << 16 plays them at the line
+ * rate. length has to be less than 65536 samples
+ */
+void audioPlay(int voice, const int8_t *samples, uint32_t length, uint32_t step, uint8_t volume, uint8_t loop) {
+	audioVoice *v = &voices[voice];
+	v->samples = 0; // off while it changes, in case this is ever called from an interrupt
+	v->end = length << 16;
+	v->phase = 0;
+	v->step = step;
+	v->left = 0;
+	v->volume = volume;
+	v->loop = loop;
+	v->samples = samples;
+}
+
+/*
+ * Play one of the wavetables at a frequency in Hz for ms milliseconds (0 for until audioStop)
+ * The step comes out within 0.2% of the frequency, which is closer than anyone can hear
+ */
+void audioTone(int voice, const int8_t *table, uint32_t frequency, uint8_t volume, uint32_t ms) {
+	audioPlay(voice, table, AUDIO_TABLE_LENGTH, (frequency << 16) / (AUDIO_RATE / AUDIO_TABLE_LENGTH), volume, 1);
+	voices[voice].left = ms * AUDIO_RATE / 1000;
+}
+
+void audioStop(int voice) {
+	voices[voice].samples = 0;
+}
+
+int audioPlaying(int voice) {
+	return voices[voice].samples != 0;
+}
+
+/*
+ * Mix the voices into the ring up to where the DMA is reading. Called once a frame, after the frame update: it's
+ * a frame's worth of samples (628) at about 15 cycles per playing voice each, so it doesn't have to fit in the vblank
+ * alongside the image copy, it only has to finish before the DMA gets round the ring
+ */
+void audioFill() {
+	int readPos = AUDIO_RING - DMA1_Channel3->CNDTR;
+	int count = readPos - writePos - 1;
+	if(count < 0)
+		count += AUDIO_RING;
+
+	while(count--) {
+		int32_t mix = 0;
+		for(audioVoice *v = voices; v < voices + AUDIO_VOICES; v++) {
+			if(!v->samples)
+				continue;
+			mix += v->samples[v->phase >> 16] * v->volume;
+			v->phase += v->step;
+			if(v->phase >= v->end) {
+				if(v->loop)
+					v->phase -= v->end;
+				else
+					v->samples = 0;
+			}
+			if(v->left && --v->left == 0)
+				v->samples = 0;
+		}
+
+		// back to a byte, clipping when the voices add up to more than full scale
+		mix = (mix >> 8) + 128;
+		if(mix < 0)
+			mix = 0;
+		else if(mix > 255)
+			mix = 255;
+		ring[writePos] = mix;
+		if(++writePos >= AUDIO_RING)
+			writePos = 0;
+	}
+}
@@ -0,0 +1,17 @@
+#include <stdint.h>
+#include "vq.h"
+#include "packed.h"
+
+/*
+ * Fixtures for the m0sim/bench.txt decoder benchmarks, so they don't depend on the asset region holding a clip of each
+ * kind. They're in flash, as an asset's header and dictionary would be, so the reads pay the same wait state.
+ * Nothing in the firmware refers to them, so the linker script keeps the .bench section by name.
+ */
+#define BENCH_FIXTURE __attribute__((section(".bench"), aligned(4), used))
+
+// vqHeaders with a one entry, all black dictionary, so the block indices can come from the zeroed screen buffer
+BENCH_FIXTURE const uint32_t benchVq4x4[1 + 4] = {4 | (4 << 8) | (1 << 16)};
+BENCH_FIXTURE const uint32_t benchVq2x2[1 + 1] = {2 | (2 << 8) | (1 << 16)};
+
+// a 16 colour packedHeader. Any byte is a valid pair of pixels, so the benchmark can take them from the asset region
+BENCH_FIXTURE const packedHeader benchPacked16 = {.bits = 4};
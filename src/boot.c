@@ -0,0 +1,63 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "uart.h"
+#include "boot.h"
+
+uint32_t bootHsiTicks = 0; // SysTick ticks at 8 MHz from the reset to the switch to the PLL
+uint32_t bootSyncUs = 0;   // microseconds from the reset to the timers starting
+uint32_t bootPictureUs = 0; // microseconds from the reset to the first frame showing an asset, 0 until there is one
+
+/*
+ * Called by SystemInit just before it switches to the PLL: note the time so far and start SysTick over
+ */
+void bootClockSwitch() {
+	bootHsiTicks = BOOT_SYSTICK_TOP - SysTick->VAL;
+	SysTick->VAL = 0; // any write clears it, and it reloads from the top
+}
+
+/*
+ * Called as soon as TIM2 and TIM3 are counting, which is the first sync pulse
+ */
+void bootSyncStarted() {
+	uint32_t pllTicks = BOOT_SYSTICK_TOP - SysTick->VAL;
+	SysTick->CTRL = 0;
+	bootSyncUs = bootHsiTicks / 8 + pllTicks / 40;
+}
+
+/*
+ * Called by showAsset once frame points at a picture. The first time, works out when the first frame to show it
+ * whole starts: TIM2 has the beam's place in the frame, and frameCount the frames since the timers started
+ */
+void bootPictureReady() {
+	if(bootPictureUs)
+		return;
+	unsigned int frames;
+	uint32_t cnt;
+	do {
+		frames = frameCount;
+		cnt = TIM2->CNT;
+	} while(frames != frameCount);
+	if(cnt >= VISIBLE_END && frames) // the vblank interrupt has counted this frame, but TIM2 hasn't started the next
+		frames--;
+	uint32_t cycles = frames * FRAME_LINES * LINE_CYCLES + cnt;
+	if(cnt < VISIBLE_START)
+		cycles += VISIBLE_START - cnt;
+	else
+		cycles += FRAME_LINES * LINE_CYCLES - cnt + VISIBLE_START;
+	bootPictureUs = bootSyncUs + cycles / 40;
+}
+
+/*
+ * print the boot time over the UART, although the monitor will take a while longer to lock on
+ */
+void bootReport() {
+	uartPrint("boot: sync after ");
+	uartPrintNum(bootSyncUs);
+	if(bootPictureUs) {
+		uartPrint(" us, first picture after ");
+		uartPrintNum(bootPictureUs);
+		uartPrint(" us\n");
+	} else {
+		uartPrint(" us, no picture yet\n");
+	}
+}
@@ -0,0 +1,246 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "assets.h"
+#include "uart.h"
+#include "flashwriter.h"
+#include "draw.h"
+
+uint32_t drawCommands = 0;      // run since startup
+uint16_t drawFrameCommands = 0; // run in the last frame update
+uint32_t drawLateFrames = 0;    // frame updates that had to leave commands for the next vblank
+uint32_t drawDropped = 0;       // packets refused, for a full queue or a bad command
+
+// commands waiting for a vblank: command, payload length, payload. DRAW_QUEUE must be a power of two
+static uint8_t queue[DRAW_QUEUE];
+static int queueHead = 0;
+static int queueTail = 0;
+static char stopped = 0; // sent XOFF
+
+// cycles kept spare at the end of the vblank, for the estimates being off
+#define DRAW_MARGIN 1000
+
+// a 3x5 font for ' ' to '_' (lower case is drawn as upper case), one octal digit per row, the high bit on the left
+#define GLYPH(a, b, c, d, e) (((a) << 12) | ((b) << 9) | ((c) << 6) | ((d) << 3) | (e))
+static const uint16_t font[64] = {
+	GLYPH(0, 0, 0, 0, 0), GLYPH(2, 2, 2, 0, 2), GLYPH(5, 5, 0, 0, 0), GLYPH(5, 7, 5, 7, 5), // space ! " #
+	GLYPH(3, 6, 2, 3, 6), GLYPH(5, 1, 2, 4, 5), GLYPH(2, 5, 2, 5, 3), GLYPH(2, 2, 0, 0, 0), // $ % & '
+	GLYPH(1, 2, 2, 2, 1), GLYPH(4, 2, 2, 2, 4), GLYPH(0, 5, 2, 5, 0), GLYPH(0, 2, 7, 2, 0), // ( ) * +
+	GLYPH(0, 0, 0, 2, 4), GLYPH(0, 0, 7, 0, 0), GLYPH(0, 0, 0, 0, 2), GLYPH(1, 1, 2, 4, 4), // , - . /
+	GLYPH(2, 5, 5, 5, 2), GLYPH(2, 6, 2, 2, 7), GLYPH(6, 1, 2, 4, 7), GLYPH(6, 1, 2, 1, 6), // 0 1 2 3
+	GLYPH(5, 5, 7, 1, 1), GLYPH(7, 4, 6, 1, 6), GLYPH(3, 4, 7, 5, 7), GLYPH(7, 1, 1, 2, 2), // 4 5 6 7
+	GLYPH(7, 5, 7, 5, 7), GLYPH(7, 5, 7, 1, 6), GLYPH(0, 2, 0, 2, 0), GLYPH(0, 2, 0, 2, 4), // 8 9 : ;
+	GLYPH(1, 2, 4, 2, 1), GLYPH(0, 7, 0, 7, 0), GLYPH(4, 2, 1, 2, 4), GLYPH(6, 1, 2, 0, 2), // < = > ?
+	GLYPH(2, 5, 7, 4, 3), GLYPH(2, 5, 7, 5, 5), GLYPH(6, 5, 6, 5, 6), GLYPH(3, 4, 4, 4, 3), // @ A B C
+	GLYPH(6, 5, 5, 5, 6), GLYPH(7, 4, 6, 4, 7), GLYPH(7, 4, 6, 4, 4), GLYPH(3, 4, 5, 5, 3), // D E F G
+	GLYPH(5, 5, 7, 5, 5), GLYPH(7, 2, 2, 2, 7), GLYPH(1, 1, 1, 5, 2), GLYPH(5, 5, 6, 5, 5), // H I J K
+	GLYPH(4, 4, 4, 4, 7), GLYPH(5, 7, 7, 5, 5), GLYPH(6, 5, 5, 5, 5), GLYPH(7, 5, 5, 5, 7), // L M N O
+	GLYPH(6, 5, 6, 4, 4), GLYPH(2, 5, 5, 6, 3), GLYPH(6, 5, 6, 5, 5), GLYPH(3, 4, 2, 1, 6), // P Q R S
+	GLYPH(7, 2, 2, 2, 2), GLYPH(5, 5, 5, 5, 7), GLYPH(5, 5, 5, 5, 2), GLYPH(5, 5, 7, 7, 5), // T U V W
+	GLYPH(5, 5, 2, 5, 5), GLYPH(5, 5, 2, 2, 2), GLYPH(7, 1, 2, 4, 7), GLYPH(6, 4, 4, 4, 6), // X Y Z [
+	GLYPH(4, 4, 2, 1, 1), GLYPH(3, 1, 1, 1, 3), GLYPH(2, 5, 0, 0, 0), GLYPH(0, 0, 0, 0, 7), // \ ] ^ _
+};
+
+static int queueFree() {
+	return (queueTail - queueHead - 1) & (DRAW_QUEUE - 1);
+}
+
+/*
+ * Fill the whole screen a word at a time (the rows are packed, so it's one run), then put the edge pixels back
+ */
+static void clearScreen(uint8_t color) {
+	uint32_t fill = color * 0x01010101;
+	uint32_t *p = (uint32_t *) screen.color;
+	for(int i = 0; i < (int) sizeof(screen.color) / 4; i++)
+		p[i] = fill;
+	for(int y = 0; y < HEIGHT; y++)
+		screen.color[y][WIDTH] = 0;
+}
+
+static void fillRect(int x, int y, int w, int h, uint8_t color) {
+	if(w > WIDTH - x)
+		w = WIDTH - x;
+	if(h > HEIGHT - y)
+		h = HEIGHT - y;
+	for(int row = y; row < y + h; row++) {
+		char *p = screen.color[row] + x;
+		for(int i = 0; i < w; i++)
+			p[i] = color;
+	}
+}
+
+static void drawText(int x, int y, uint8_t color, const uint8_t *text, int length) {
+	for(int n = 0; n < length && x < WIDTH; n++, x += 4) {
+		int c = text[n];
+		if(c >= 'a' && c <= 'z')
+			c -= 'a' - 'A';
+		if(c < ' ' || c > '_')
+			c = '?';
+		uint16_t glyph = font[c - ' '];
+		for(int row = 0; row < 5 && y + row < HEIGHT; row++) {
+			int bits = (glyph >> (12 - 3 * row)) & 0x7;
+			for(int col = 0; col < 3 && x + col < WIDTH; col++) {
+				if(bits & (0x4 >> col))
+					screen.color[y + row][x + col] = color;
+			}
+		}
+	}
+}
+
+// the indexed asset a blit would copy, or 0 if there isn't a usable one
+static const assetEntry *blitSource(uint16_t id) {
+	if(flashWriterActive()) // the asset region is being rewritten
+		return 0;
+	const assetEntry *asset = assetFind(id);
+	if(!asset || asset->format != ASSET_FORMAT_INDEXED || asset->palette != PALETTE)
+		return 0;
+	// any size can be blitted, but all of its pixels have to be there
+	if(!assetInRegion(asset) || asset->length < (uint32_t) asset->width * asset->height)
+		return 0;
+	return asset;
+}
+
+static void blit(uint16_t id, int x, int y) {
+	const assetEntry *asset = blitSource(id);
+	if(!asset)
+		return;
+	const char *pixels = assetData(asset);
+	int w = asset->width < WIDTH - x ? asset->width : WIDTH - x;
+	int h = asset->height < HEIGHT - y ? asset->height : HEIGHT - y;
+	for(int row = 0; row < h; row++) {
+		const char *src = pixels + row * asset->width;
+		char *dst = screen.color[y + row] + x;
+		for(int i = 0; i < w; i++)
+			dst[i] = src[i];
+	}
+}
+
+/*
+ * a generous estimate of the cycles a command takes, about 4 a pixel written plus the loops around them
+ */
+static uint32_t commandCycles(uint8_t cmd, const uint8_t *p, uint8_t len) {
+	uint32_t w, h;
+	switch(cmd) {
+	case 'X':
+		return 8000;
+	case 'R':
+		w = p[2] < WIDTH ? p[2] : WIDTH;
+		h = p[3] < HEIGHT ? p[3] : HEIGHT;
+		return w * h * 4 + h * 20 + 200;
+	case 'T':
+		return (len - 3) * 150 + 200;
+	case 'B': {
+		const assetEntry *asset = blitSource(p[0] | (p[1] << 8));
+		if(!asset)
+			return 200;
+		w = asset->width < WIDTH ? asset->width : WIDTH;
+		h = asset->height < HEIGHT ? asset->height : HEIGHT;
+		return w * h * 4 + h * 20 + 400;
+	}
+	}
+	return 0;
+}
+
+static void runCommand(uint8_t cmd, const uint8_t *p, uint8_t len) {
+	// nothing is drawn off the screen, and the loops clip the far sides
+	if(cmd != 'X' && (p[cmd == 'B' ? 2 : 0] >= WIDTH || p[cmd == 'B' ? 3 : 1] >= HEIGHT))
+		return;
+	switch(cmd) {
+	case 'X':
+		clearScreen(p[0]);
+		break;
+	case 'R':
+		fillRect(p[0], p[1], p[2], p[3], p[4]);
+		break;
+	case 'T':
+		drawText(p[0], p[1], p[2], p + 3, len - 3);
+		break;
+	case 'B':
+		blit(p[0] | (p[1] << 8), p[2], p[3]);
+		break;
+	}
+}
+
+/*
+ * Queue a command from a packet. Returns 1 if it was queued (or answered, for 'Q'), 0 if it was refused,
+ * and -1 if it isn't a drawing command at all
+ */
+int drawQueue(uint8_t cmd, const uint8_t *payload, uint8_t len) {
+	int ok;
+	switch(cmd) {
+	case 'X':
+		ok = len == 1;
+		break;
+	case 'R':
+		ok = len == 5;
+		break;
+	case 'T':
+		ok = len >= 3;
+		break;
+	case 'B':
+		ok = len == 4;
+		break;
+	case 'Q':
+		uartPrintNum((queueHead - queueTail) & (DRAW_QUEUE - 1));
+		uartWrite(' ');
+		uartPrintNum(drawFrameCommands);
+		uartWrite(' ');
+		uartPrintNum(drawCommands);
+		uartWrite(' ');
+		uartPrintNum(drawLateFrames);
+		uartWrite(' ');
+		uartPrintNum(drawDropped);
+		uartWrite('\n');
+		return 1;
+	default:
+		return -1;
+	}
+	if(!ok || queueFree() < len + 2) {
+		drawDropped++;
+		return 0;
+	}
+
+	queue[queueHead] = cmd;
+	queue[(queueHead + 1) & (DRAW_QUEUE - 1)] = len;
+	for(int i = 0; i < len; i++)
+		queue[(queueHead + 2 + i) & (DRAW_QUEUE - 1)] = payload[i];
+	queueHead = (queueHead + 2 + len) & (DRAW_QUEUE - 1);
+
+	// stop the host while there's still room for what it has already sent
+	if(!stopped && queueFree() < 2 * DRAW_ENTRY_MAX) {
+		uartWrite(DRAW_XOFF);
+		stopped = 1;
+	}
+	return 1;
+}
+
+int drawPending() {
+	return queueHead != queueTail;
+}
+
+/*
+ * Run queued commands until the queue is empty or the next one might not finish before the first visible line
+ * Call it in the frame update, after anything else that has to be done in the vblank
+ */
+void drawRun() {
+	uint8_t payload[DRAW_ENTRY_MAX - 2];
+	drawFrameCommands = 0;
+	while(queueHead != queueTail) {
+		uint8_t cmd = queue[queueTail];
+		uint8_t len = queue[(queueTail + 1) & (DRAW_QUEUE - 1)];
+		for(int i = 0; i < len; i++)
+			payload[i] = queue[(queueTail + 2 + i) & (DRAW_QUEUE - 1)];
+		if(vblankCyclesLeft() < commandCycles(cmd, payload, len) + DRAW_MARGIN) {
+			drawLateFrames++;
+			break;
+		}
+		queueTail = (queueTail + 2 + len) & (DRAW_QUEUE - 1);
+		runCommand(cmd, payload, len);
+		drawFrameCommands++;
+		drawCommands++;
+	}
+
+	if(stopped && queueFree() >= DRAW_QUEUE / 2) {
+		uartWrite(DRAW_XON);
+		stopped = 0;
+	}
+}
@@ -0,0 +1,214 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "uart.h"
+#include "flashwriter.h"
+#include "draw.h"
+#include "shell.h"
+
+#define SYNC 0xA5
+#define MAX_DATA 64
+#define PAGE_SIZE 1024
+
+#define FLASH_KEY1 0x45670123
+#define FLASH_KEY2 0xCDEF89AB
+
+// worst case half-word program time is 70 us (2800 cycles), plus some for the loop around it
+#define PROGRAM_CYCLES 3000
+
+extern const char _sassets[];
+extern const char _eassetregion[]; // the end of the ASSETS region, not of the assets linked into it
+extern uint32_t g_pfnVectors[];
+
+// the vector table is copied here (the start of RAM) and RAM is mapped to address 0
+#define VECTORS 48
+uint32_t ramVectors[VECTORS] __attribute__((section(".ram_vectors")));
+
+// packet being received
+static uint8_t packet[2 + 2 + MAX_DATA + 1]; // command, length, offset, data, checksum
+static int packetLen = -1; // -1 while waiting for the sync byte
+
+// the erase or write waiting for a vblank to run in
+static uint8_t pendingCmd = 0;
+static uint32_t pendingAddr;
+static uint8_t pendingLen;
+static uint8_t pendingPos;
+static uint8_t pendingData[MAX_DATA];
+
+static char active = 0;
+static uint32_t bytesWritten;
+static unsigned int startFrame;
+
+/*
+ * The hardware fetches vectors from flash, so an interrupt during a flash operation would wait for it to finish.
+ * Copy the table into RAM and remap RAM to address 0 (the M0 has no VTOR) so the video interrupts never touch flash.
+ */
+void relocateVectors() {
+	for(int i = 0; i < VECTORS; i++)
+		ramVectors[i] = g_pfnVectors[i];
+	RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;
+	SYSCFG->CFGR1 = (SYSCFG->CFGR1 & ~SYSCFG_CFGR1_MEM_MODE) | SYSCFG_CFGR1_MEM_MODE; // 0b11 is SRAM at 0
+}
+
+/*
+ * These spin on BSY from RAM: if they were in flash the CPU would stall on the next fetch and couldn't take interrupts
+ */
+RAMFUNC static int flashErase(uint32_t addr) {
+	FLASH->CR |= FLASH_CR_PER;
+	FLASH->AR = addr;
+	FLASH->CR |= FLASH_CR_STRT;
+	while(FLASH->SR & FLASH_SR_BSY);
+	FLASH->CR &= ~FLASH_CR_PER;
+	uint32_t sr = FLASH->SR;
+	FLASH->SR = FLASH_SR_EOP | FLASH_SR_PGERR | FLASH_SR_WRPERR; // write 1 to clear
+	return (sr & (FLASH_SR_PGERR | FLASH_SR_WRPERR)) == 0;
+}
+
+RAMFUNC static int flashProgram(uint32_t addr, uint16_t data) {
+	FLASH->CR |= FLASH_CR_PG;
+	*(volatile uint16_t *) (uintptr_t) addr = data;
+	while(FLASH->SR & FLASH_SR_BSY);
+	FLASH->CR &= ~FLASH_CR_PG;
+	uint32_t sr = FLASH->SR;
+	FLASH->SR = FLASH_SR_EOP | FLASH_SR_PGERR | FLASH_SR_WRPERR;
+	return (sr & (FLASH_SR_PGERR | FLASH_SR_WRPERR)) == 0 && *(volatile uint16_t *) (uintptr_t) addr == data;
+}
+
+static void finish(char reply) {
+	pendingCmd = 0;
+	FLASH->CR |= FLASH_CR_LOCK;
+	uartWrite(reply);
+}
+
+static void unlock() {
+	if(FLASH->CR & FLASH_CR_LOCK) {
+		FLASH->KEYR = FLASH_KEY1;
+		FLASH->KEYR = FLASH_KEY2;
+	}
+}
+
+// act on a complete packet, returns 1 if it ended the update
+static int handlePacket() {
+	uint8_t cmd = packet[0];
+	uint8_t len = packet[1];
+	uint8_t *payload = &packet[2];
+	uint32_t size = _eassetregion - _sassets; // an update can be bigger than the assets it replaces
+
+	int queued = drawQueue(cmd, payload, len);
+	if(queued == 0)
+		uartWrite('N');
+	if(queued >= 0)
+		return 0;
+
+	if(pendingCmd) { // the host didn't wait for the last answer
+		uartWrite('N');
+		return 0;
+	}
+
+	if(cmd == 'S') {
+		unsigned int frames = frameCount - startFrame;
+		uartPrintNum(bytesWritten);
+		uartWrite(' ');
+		uartPrintNum(frames);
+		uartWrite(' ');
+		uartPrintNum(frames ? bytesWritten * 60 / frames : 0);
+		uartWrite('\n');
+		return 0;
+	}
+	if(cmd == 'D') {
+		uartWrite('K');
+		if(active) {
+			active = 0;
+			return 1;
+		}
+		return 0;
+	}
+
+	if(cmd == 'E' && len == 1 && payload[0] < size / PAGE_SIZE) {
+		pendingAddr = (uint32_t) (uintptr_t) _sassets + payload[0] * PAGE_SIZE;
+	} else if(cmd == 'W' && len >= 2 && (len & 1) == 0) {
+		uint32_t offset = payload[0] | (payload[1] << 8);
+		pendingLen = len - 2;
+		if((offset & 1) || offset + pendingLen > size) {
+			uartWrite('N');
+			return 0;
+		}
+		pendingAddr = (uint32_t) (uintptr_t) _sassets + offset;
+		pendingPos = 0;
+		for(int i = 0; i < pendingLen; i++)
+			pendingData[i] = payload[2 + i];
+	} else {
+		uartWrite('N');
+		return 0;
+	}
+
+	if(!active) {
+		active = 1;
+		bytesWritten = 0;
+		startFrame = frameCount;
+	}
+	unlock();
+	pendingCmd = cmd;
+	return 0;
+}
+
+/*
+ * Feed received bytes through the packet parser, and anything outside a packet to the shell. Cheap, so call it as
+ * often as you like.
+ * Returns 1 when the host has finished an update and the assets should be looked up again.
+ */
+int flashWriterPoll() {
+	int c;
+	int done = 0;
+	while((c = uartRead()) >= 0) {
+		if(packetLen < 0) {
+			if(c == SYNC)
+				packetLen = 0;
+			else
+				shellInput(c);
+			continue;
+		}
+		packet[packetLen++] = c;
+		// command and length, then the payload, then the checksum
+		if(packetLen >= 2 && (packet[1] > MAX_DATA + 2 || packetLen == packet[1] + 3)) {
+			uint8_t sum = 0;
+			for(int i = 0; i < packetLen; i++)
+				sum ^= packet[i];
+			if(packet[1] > MAX_DATA + 2 || sum != 0)
+				uartWrite('N');
+			else
+				done |= handlePacket();
+			packetLen = -1;
+		}
+	}
+	return done;
+}
+
+/*
+ * Whether an update has started. The asset region can't be read until it's over
+ */
+int flashWriterActive() {
+	return active;
+}
+
+/*
+ * Call right after the vblank interrupt. Programs as many half-words as fit before the visible region starts.
+ * A page erase takes far longer than the vblank (20-40 ms), so it is only started here. Everything the
+ * video needs runs from RAM, so the picture keeps going while the main loop sits in flashErase.
+ */
+void flashWriterRun() {
+	if(pendingCmd == 'E') {
+		finish(flashErase(pendingAddr) ? 'K' : 'N');
+	} else if(pendingCmd == 'W') {
+		while(pendingPos < pendingLen && vblankCyclesLeft() > PROGRAM_CYCLES) {
+			uint16_t data = pendingData[pendingPos] | (pendingData[pendingPos + 1] << 8);
+			if(!flashProgram(pendingAddr + pendingPos, data)) {
+				finish('N');
+				return;
+			}
+			pendingPos += 2;
+			bytesWritten += 2;
+		}
+		if(pendingPos >= pendingLen)
+			finish('K');
+	}
+}
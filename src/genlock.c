@@ -0,0 +1,122 @@
+#include "regs.h"
+#include "vga.h"
+#include "genlock.h"
+
+volatile uint8_t genlockState = GENLOCK_OFF;
+
+// the source's line the beam is on, kept by the line interrupt while genlocked (see TIM3_IRQHandler)
+volatile int syncLine = 0;
+// vsync edges the line interrupt has seen, and the TIM2 count captured at the last one
+volatile uint32_t syncVsyncs = 0;
+volatile uint32_t genlockCapture = 0;
+
+// phase error in cycles at the last hsync and vsync: how much later than this board expected the edge came
+int32_t genlockLineError = 0;
+int32_t genlockFrameError = 0;
+// frames it took to lock, counted from genlockStart or from when the lock was lost
+uint32_t genlockLockFrames = 0;
+
+static uint32_t searchFrames = 0;
+static int goodFrames = 0;
+static uint32_t lastVsyncs = 0;
+
+/*
+ * Point a timer's CC1 at its input pin as a capture of the rising (or falling) edge, filtered over 4 samples,
+ * and reset the counter on the same edge (slave mode 4, trigger 5 = TI1FP1). The capture has the count from just before
+ * the reset, so it's how long the line or frame was by this board's clock
+ */
+static void captureAndReset(TIM_TypeDef *tim, int falling) {
+	REG_CLEAR(tim->CCER, TIM_CCER_CC1E | TIM_CCER_CC1P); // CC1S can only be changed while the channel is off
+	REG_CLEAR(tim->CCMR1, 0xff);
+	REG_SET(tim->CCMR1, TIM_CCMR1_CC1S_0 | (0x2 << 4));
+	if(falling)
+		REG_SET(tim->CCER, TIM_CCER_CC1P);
+	REG_SET(tim->CCER, TIM_CCER_CC1E);
+	REG_WRITE(tim->SMCR, (0x5 << 4) | 0x4);
+}
+
+/*
+ * Start following the sync inputs. Can be called with the video running: the picture rolls into place over a frame
+ */
+void genlockStart(uint8_t flags) {
+	REG_CLEAR(GPIOA->MODER, (0x3 << (2 * 6)) | (0x3 << (2 * 0)));
+	REG_SET(GPIOA->MODER, (0x2 << (2 * 6)) | (0x2 << (2 * 0))); // A6 and A0 alternate function
+	REG_CLEAR(GPIOA->AFR[0], (0xf << (4 * 6)) | (0xf << (4 * 0)));
+	REG_SET(GPIOA->AFR[0], (0x1 << (4 * 6)) | (0x2 << (4 * 0))); // AF1 == TIM3_CH1, AF2 == TIM2_CH1
+
+	// CC1 is about to become the hsync capture, so the pixel trigger moves to OC4REF, which PWM mode 2 makes rise
+	// at the same count (TIM15 starts on the rising edge either way)
+	REG_WRITE(TIM3->CCR4, PIXEL_START);
+	REG_SET(TIM3->CCMR2, (0x7 << 4) << 8);
+	REG_CLEAR(TIM3->CR2, 0x7 << 4);
+	REG_SET(TIM3->CR2, 0x7 << 4); // CR2_MMS = 0x7 is OC4REF
+
+	// let a slow line run on a bit for the hsync instead of wrapping just before it. If the hsync goes away the lines
+	// get this much longer, which monitors still sync to
+	REG_WRITE(TIM3->ARR, LINE_CYCLES - 1 + GENLOCK_SLACK);
+
+	captureAndReset(TIM3, flags & GENLOCK_HSYNC_FALLING);
+	captureAndReset(TIM2, flags & GENLOCK_VSYNC_FALLING);
+
+	lastVsyncs = syncVsyncs;
+	searchFrames = 0;
+	goodFrames = 0;
+	genlockLockFrames = 0;
+	syncLine = 0;
+	genlockState = GENLOCK_SEARCHING; // the line interrupt starts keeping TIM2 in step
+}
+
+/*
+ * Go back to free running, with the timers set up the way setupHorizontalTimers and setupVerticalTimer leave them
+ */
+void genlockStop() {
+	genlockState = GENLOCK_OFF;
+	REG_WRITE(TIM2->SMCR, 0);
+	REG_WRITE(TIM3->SMCR, 0);
+	REG_CLEAR(TIM2->CCER, TIM_CCER_CC1E | TIM_CCER_CC1P);
+	REG_CLEAR(TIM2->CCMR1, 0xff);
+	REG_CLEAR(TIM3->CCER, TIM_CCER_CC1P);
+	REG_CLEAR(TIM3->CCMR1, 0xff);
+	REG_WRITE(TIM3->CCR1, PIXEL_START);
+	REG_CLEAR(TIM3->CR2, 0x7 << 4);
+	REG_SET(TIM3->CR2, 0x3 << 4); // back to the CC1 compare pulse
+	REG_CLEAR(TIM3->CCMR2, (0x7 << 4) << 8);
+	REG_WRITE(TIM3->ARR, LINE_CYCLES - 1);
+	REG_CLEAR(GPIOA->MODER, (0x3 << (2 * 6)) | (0x3 << (2 * 0)));
+}
+
+/*
+ * Once a frame in the vblank: work out the phase errors and whether it's locked. Gives back genlockState
+ * An edge that comes early is captured near the end of the count, one that comes late after the counter has wrapped
+ */
+uint8_t genlockUpdate() {
+	if(genlockState == GENLOCK_OFF)
+		return GENLOCK_OFF;
+
+	// reading the capture clears the flag, so the flag says whether there was an hsync since the last frame
+	int hsync = TIM3->SR & TIM_SR_CC1IF;
+	genlockLineError = (int32_t) TIM3->CCR1 - LINE_CYCLES;
+	int vsync = syncVsyncs != lastVsyncs;
+	lastVsyncs = syncVsyncs;
+	// TIM2 wraps after exactly a frame of this board's lines, so take out the part that's the lines being a different length
+	int32_t frameError = genlockCapture;
+	if(frameError >= FRAME_LINES * LINE_CYCLES / 2)
+		frameError -= FRAME_LINES * LINE_CYCLES;
+	frameError -= genlockLineError;
+	genlockFrameError = frameError;
+
+	searchFrames++;
+	if(hsync && vsync && genlockLineError <= GENLOCK_TOLERANCE && genlockLineError >= -GENLOCK_TOLERANCE
+			&& frameError <= GENLOCK_TOLERANCE && frameError >= -GENLOCK_TOLERANCE) {
+		if(genlockState == GENLOCK_SEARCHING && ++goodFrames >= GENLOCK_SETTLE_FRAMES) {
+			genlockState = GENLOCK_LOCKED;
+			genlockLockFrames = searchFrames;
+		}
+	} else {
+		if(genlockState == GENLOCK_LOCKED)
+			searchFrames = 0; // time the relock from here
+		genlockState = GENLOCK_SEARCHING;
+		goodFrames = 0;
+	}
+	return genlockState;
+}
@@ -1,62 +0,0 @@
-const char lenna[4800] = {
-27, 27, 27, 27, 27, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 27, 27, 23, 27, 27, 27, 23, 27, 27, 27, 27, 43, 43, 43, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 
-27, 27, 27, 27, 27, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 43, 43, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 17, 
-27, 27, 27, 27, 27, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 27, 27, 27, 27, 27, 27, 27, 27, 23, 23, 23, 27, 43, 43, 26, 22, 22, 22, 22, 22, 22, 22, 22, 22, 17, 17, 17, 
-27, 27, 27, 27, 27, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 27, 27, 27, 27, 27, 27, 27, 27, 27, 23, 23, 27, 43, 43, 22, 22, 22, 22, 22, 22, 22, 22, 17, 17, 17, 17, 
-27, 27, 27, 27, 27, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 27, 27, 27, 27, 27, 27, 27, 27, 23, 23, 23, 23, 43, 47, 43, 22, 22, 22, 22, 22, 17, 17, 17, 17, 17, 17, 
-27, 27, 27, 27, 23, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 42, 42, 42, 42, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 27, 23, 23, 27, 23, 23, 23, 23, 23, 23, 27, 43, 47, 43, 22, 22, 22, 17, 17, 17, 17, 17, 17, 17, 
-27, 27, 27, 23, 23, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 38, 22, 38, 42, 42, 42, 42, 42, 43, 43, 42, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27, 43, 47, 43, 22, 17, 17, 17, 17, 17, 17, 17, 17, 
-27, 27, 23, 22, 22, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 42, 42, 42, 42, 43, 43, 43, 43, 43, 42, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27, 47, 26, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
-27, 23, 22, 22, 22, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 42, 22, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 22, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 
-27, 22, 22, 22, 22, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 47, 42, 22, 22, 22, 22, 22, 22, 23, 23, 23, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 22, 17, 17, 17, 17, 17, 17, 17, 17, 21, 21, 22, 
-22, 22, 22, 22, 22, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 47, 42, 22, 22, 22, 22, 22, 23, 23, 23, 23, 22, 18, 22, 23, 23, 23, 23, 23, 23, 23, 22, 17, 17, 17, 17, 17, 17, 17, 17, 21, 22, 22, 22, 
-22, 22, 22, 22, 22, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 42, 22, 22, 22, 22, 23, 23, 23, 23, 22, 17, 22, 22, 23, 23, 23, 23, 23, 22, 17, 17, 17, 17, 17, 17, 17, 17, 17, 22, 22, 22, 26, 
-22, 22, 22, 22, 22, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 22, 22, 22, 23, 23, 23, 23, 22, 17, 17, 22, 22, 23, 23, 23, 22, 17, 17, 17, 17, 17, 17, 17, 17, 17, 22, 22, 22, 26, 27, 
-22, 22, 22, 22, 22, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 22, 22, 23, 23, 23, 23, 22, 17, 17, 21, 42, 43, 43, 43, 17, 17, 17, 17, 17, 17, 17, 17, 17, 22, 22, 22, 26, 26, 26, 
-22, 22, 22, 22, 22, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 42, 22, 23, 23, 23, 22, 22, 17, 38, 43, 43, 43, 43, 47, 21, 17, 17, 17, 17, 17, 17, 17, 22, 22, 22, 27, 27, 26, 26, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 23, 23, 23, 22, 38, 42, 43, 43, 43, 43, 43, 47, 22, 17, 17, 17, 17, 17, 17, 22, 38, 22, 27, 27, 26, 26, 26, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 22, 22, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 27, 43, 43, 43, 43, 43, 43, 43, 43, 43, 47, 21, 17, 17, 17, 17, 17, 22, 22, 22, 27, 27, 26, 26, 26, 26, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 26, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 17, 17, 17, 17, 17, 21, 22, 22, 42, 43, 43, 26, 26, 26, 26, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 42, 42, 43, 22, 17, 17, 17, 17, 17, 22, 22, 42, 43, 43, 42, 26, 26, 26, 26, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 43, 42, 42, 38, 38, 42, 42, 43, 43, 43, 43, 43, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 42, 42, 22, 43, 17, 17, 17, 17, 17, 22, 22, 26, 43, 42, 26, 26, 26, 26, 26, 26, 
-22, 22, 22, 22, 23, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 27, 23, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 38, 38, 38, 38, 38, 38, 22, 22, 22, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 42, 22, 22, 43, 22, 17, 17, 17, 17, 22, 22, 22, 42, 27, 26, 26, 26, 26, 26, 26, 26, 
-22, 22, 22, 22, 23, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 38, 21, 21, 21, 17, 17, 21, 38, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 42, 22, 22, 22, 22, 42, 22, 17, 17, 17, 17, 17, 22, 22, 42, 42, 42, 42, 42, 42, 26, 26, 26, 26, 
-22, 22, 22, 22, 23, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 43, 23, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 17, 17, 22, 21, 21, 21, 17, 21, 22, 42, 43, 43, 43, 43, 43, 43, 43, 43, 42, 42, 22, 22, 22, 22, 43, 42, 21, 17, 17, 17, 17, 17, 22, 22, 26, 43, 43, 42, 42, 42, 42, 26, 26, 26, 26, 
-22, 22, 22, 22, 23, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 27, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 17, 17, 17, 21, 17, 21, 21, 21, 21, 22, 43, 43, 43, 43, 42, 42, 43, 43, 43, 22, 22, 22, 22, 38, 27, 43, 22, 17, 17, 17, 17, 17, 17, 17, 22, 22, 43, 43, 43, 42, 42, 42, 42, 42, 42, 26, 26, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 43, 23, 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 17, 21, 17, 17, 17, 17, 21, 38, 38, 42, 43, 43, 42, 42, 42, 42, 43, 43, 43, 43, 22, 22, 22, 38, 26, 21, 17, 17, 17, 17, 17, 17, 17, 22, 22, 42, 43, 42, 42, 43, 42, 42, 42, 42, 42, 26, 26, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 27, 43, 22, 22, 22, 22, 22, 22, 22, 21, 17, 17, 21, 17, 21, 21, 17, 17, 17, 22, 38, 42, 43, 43, 42, 42, 42, 43, 43, 43, 43, 43, 43, 22, 17, 21, 38, 22, 17, 17, 17, 17, 17, 17, 17, 21, 22, 22, 26, 43, 43, 42, 42, 42, 42, 42, 42, 42, 26, 26, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 22, 22, 22, 22, 22, 22, 17, 17, 17, 17, 17, 17, 21, 21, 17, 21, 22, 42, 42, 42, 43, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43, 23, 17, 17, 22, 22, 17, 17, 17, 17, 17, 17, 17, 22, 22, 26, 26, 26, 26, 26, 26, 26, 42, 42, 42, 26, 26, 26, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 22, 22, 22, 22, 17, 17, 17, 17, 17, 17, 17, 17, 21, 21, 22, 22, 43, 43, 42, 42, 42, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 22, 17, 22, 22, 17, 17, 17, 17, 17, 17, 21, 22, 22, 42, 42, 26, 42, 26, 26, 26, 26, 26, 26, 26, 26, 26, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 17, 21, 17, 21, 17, 17, 17, 21, 17, 21, 22, 43, 43, 43, 43, 22, 22, 22, 43, 43, 43, 43, 43, 43, 43, 43, 43, 43, 22, 17, 17, 38, 17, 17, 17, 17, 17, 17, 22, 22, 26, 26, 26, 26, 42, 42, 26, 26, 26, 22, 22, 22, 22, 22, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 23, 22, 21, 22, 22, 21, 21, 21, 21, 17, 17, 17, 17, 21, 17, 21, 22, 43, 43, 42, 42, 22, 22, 22, 22, 22, 22, 43, 43, 43, 43, 43, 43, 22, 22, 22, 17, 17, 38, 17, 17, 17, 17, 17, 17, 22, 22, 27, 26, 26, 26, 26, 26, 26, 26, 26, 42, 42, 26, 22, 22, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 26, 23, 23, 22, 22, 17, 21, 21, 21, 17, 17, 21, 17, 21, 17, 17, 17, 22, 43, 43, 43, 22, 18, 17, 17, 22, 17, 22, 22, 23, 23, 43, 43, 22, 22, 22, 17, 17, 17, 17, 38, 22, 17, 17, 17, 17, 22, 22, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 42, 26, 22, 22, 22, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 42, 43, 22, 17, 17, 17, 21, 21, 38, 17, 17, 17, 17, 17, 17, 17, 22, 42, 43, 43, 22, 22, 17, 22, 22, 42, 43, 22, 22, 23, 23, 43, 42, 22, 22, 38, 22, 17, 17, 17, 38, 22, 17, 17, 17, 17, 22, 22, 26, 26, 26, 26, 26, 26, 26, 26, 26, 22, 22, 22, 22, 22, 42, 
-22, 22, 22, 22, 22, 27, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 38, 38, 21, 21, 21, 21, 17, 21, 21, 38, 21, 17, 17, 17, 17, 17, 22, 42, 43, 42, 22, 22, 23, 22, 22, 22, 38, 43, 23, 22, 23, 23, 43, 43, 22, 22, 22, 22, 17, 17, 17, 22, 22, 17, 17, 17, 22, 22, 26, 26, 26, 26, 26, 26, 26, 26, 22, 22, 22, 22, 26, 26, 43, 43, 
-22, 22, 22, 18, 22, 23, 27, 27, 27, 23, 22, 22, 22, 22, 22, 38, 22, 21, 17, 21, 38, 21, 17, 21, 37, 38, 21, 17, 17, 17, 17, 22, 22, 43, 42, 22, 22, 23, 39, 43, 43, 43, 43, 43, 39, 23, 23, 23, 43, 43, 43, 23, 22, 22, 18, 17, 17, 22, 22, 17, 17, 17, 22, 22, 26, 26, 26, 26, 26, 26, 26, 22, 22, 22, 22, 43, 43, 43, 43, 43, 
-22, 22, 22, 17, 22, 23, 27, 27, 27, 23, 22, 22, 22, 22, 38, 22, 21, 17, 21, 38, 21, 17, 17, 17, 21, 21, 22, 22, 17, 17, 17, 22, 43, 42, 18, 22, 23, 23, 23, 43, 43, 43, 43, 43, 23, 23, 23, 23, 43, 43, 43, 23, 23, 22, 18, 17, 17, 22, 22, 17, 17, 17, 22, 26, 26, 26, 26, 26, 26, 22, 22, 22, 22, 22, 43, 43, 43, 43, 43, 43, 
-22, 22, 18, 17, 22, 23, 27, 27, 27, 23, 22, 22, 22, 22, 22, 22, 22, 21, 21, 38, 21, 17, 17, 17, 17, 17, 22, 22, 17, 17, 22, 42, 42, 17, 18, 22, 23, 23, 23, 27, 43, 43, 43, 27, 23, 23, 23, 23, 43, 43, 43, 23, 23, 22, 17, 17, 17, 22, 22, 17, 17, 22, 22, 26, 26, 26, 26, 26, 22, 22, 22, 22, 22, 27, 43, 27, 43, 43, 43, 43, 
-22, 22, 17, 17, 22, 23, 27, 27, 27, 23, 22, 22, 22, 38, 21, 22, 21, 21, 37, 38, 21, 17, 17, 17, 22, 22, 22, 22, 17, 22, 22, 42, 17, 17, 18, 22, 23, 23, 23, 23, 27, 43, 43, 27, 23, 23, 23, 23, 43, 43, 43, 23, 23, 22, 17, 17, 17, 22, 42, 17, 17, 22, 22, 26, 26, 26, 26, 26, 26, 22, 22, 22, 27, 43, 43, 43, 43, 43, 43, 43, 
-22, 22, 18, 17, 22, 23, 27, 27, 27, 23, 22, 22, 22, 22, 21, 38, 21, 21, 21, 38, 21, 17, 17, 17, 21, 22, 17, 17, 22, 42, 42, 21, 17, 17, 22, 22, 23, 23, 23, 23, 23, 23, 27, 23, 22, 23, 22, 22, 23, 43, 23, 23, 22, 17, 17, 17, 17, 17, 42, 21, 21, 22, 26, 26, 26, 26, 26, 26, 22, 22, 22, 22, 43, 43, 43, 43, 43, 43, 43, 43, 
-22, 22, 18, 18, 22, 27, 27, 27, 27, 23, 22, 22, 22, 22, 21, 21, 21, 21, 21, 38, 38, 21, 17, 22, 17, 21, 21, 22, 22, 42, 21, 17, 17, 21, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 22, 22, 43, 43, 23, 23, 22, 17, 17, 21, 17, 17, 22, 22, 22, 22, 26, 26, 26, 26, 26, 22, 22, 22, 22, 27, 43, 43, 43, 43, 43, 43, 43, 43, 
-22, 18, 18, 18, 22, 27, 27, 27, 27, 23, 22, 22, 22, 22, 21, 21, 21, 17, 21, 37, 37, 38, 22, 21, 17, 22, 42, 22, 22, 21, 17, 17, 17, 17, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 43, 43, 43, 43, 23, 22, 17, 17, 17, 22, 17, 17, 22, 22, 22, 26, 26, 26, 26, 26, 22, 22, 22, 22, 22, 27, 43, 43, 43, 43, 43, 43, 43, 43, 
-17, 18, 18, 18, 22, 27, 27, 27, 27, 23, 22, 22, 22, 22, 21, 21, 17, 21, 21, 21, 21, 38, 22, 21, 38, 42, 22, 22, 21, 17, 17, 17, 17, 17, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 43, 43, 23, 22, 22, 17, 17, 17, 22, 17, 17, 22, 22, 22, 26, 26, 26, 22, 26, 22, 22, 22, 22, 22, 27, 43, 43, 43, 43, 43, 43, 43, 43, 
-17, 17, 17, 22, 22, 27, 27, 27, 27, 23, 22, 22, 22, 22, 17, 17, 21, 21, 38, 37, 21, 21, 21, 22, 43, 42, 22, 21, 17, 17, 17, 17, 17, 17, 22, 22, 22, 23, 23, 23, 23, 23, 22, 22, 23, 23, 23, 39, 22, 22, 22, 17, 17, 17, 17, 22, 17, 17, 22, 22, 23, 26, 26, 26, 26, 26, 26, 22, 22, 22, 22, 43, 43, 43, 43, 43, 43, 43, 43, 43, 
-17, 17, 17, 22, 22, 27, 27, 27, 43, 23, 22, 22, 22, 21, 21, 17, 21, 37, 38, 37, 21, 38, 38, 38, 42, 26, 22, 17, 17, 17, 17, 17, 17, 17, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 22, 17, 17, 17, 17, 17, 22, 17, 17, 22, 26, 26, 26, 26, 26, 26, 26, 26, 22, 22, 22, 22, 43, 43, 43, 43, 43, 43, 43, 43, 43, 
-17, 17, 17, 22, 22, 23, 27, 27, 27, 23, 22, 22, 22, 21, 21, 17, 17, 21, 38, 38, 38, 38, 22, 38, 42, 22, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 22, 22, 22, 22, 23, 23, 23, 23, 23, 27, 23, 23, 22, 17, 17, 17, 17, 17, 17, 22, 22, 17, 22, 43, 26, 26, 26, 26, 26, 26, 26, 22, 22, 22, 22, 43, 43, 43, 43, 43, 43, 43, 43, 43, 
-17, 17, 17, 22, 22, 23, 27, 27, 27, 23, 22, 22, 21, 21, 17, 17, 17, 21, 21, 21, 38, 38, 38, 22, 22, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 22, 22, 22, 23, 23, 23, 43, 43, 43, 39, 22, 17, 17, 17, 17, 17, 22, 22, 22, 22, 22, 43, 26, 26, 26, 26, 26, 26, 26, 22, 22, 22, 26, 47, 43, 43, 43, 43, 43, 43, 43, 26, 
-17, 17, 17, 22, 22, 23, 27, 27, 27, 23, 22, 22, 21, 21, 17, 17, 17, 21, 38, 21, 21, 38, 38, 38, 38, 21, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 22, 22, 22, 22, 22, 22, 23, 23, 43, 43, 43, 22, 21, 17, 17, 17, 17, 22, 22, 22, 22, 22, 26, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 43, 43, 43, 43, 43, 27, 22, 17, 17, 
-22, 17, 17, 17, 22, 23, 27, 27, 43, 27, 22, 22, 17, 17, 21, 17, 21, 17, 38, 38, 38, 38, 37, 38, 38, 38, 21, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 22, 22, 22, 22, 22, 23, 23, 23, 23, 27, 43, 43, 43, 42, 22, 21, 17, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 43, 43, 43, 43, 26, 21, 17, 22, 22, 
-38, 22, 22, 17, 18, 23, 27, 27, 27, 23, 22, 22, 17, 17, 22, 21, 22, 21, 21, 21, 21, 21, 38, 38, 38, 22, 21, 21, 17, 17, 17, 17, 17, 17, 17, 21, 17, 22, 22, 22, 22, 23, 23, 23, 23, 23, 43, 43, 43, 43, 43, 43, 43, 22, 17, 21, 21, 17, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 43, 43, 43, 22, 17, 22, 22, 22, 22, 
-22, 42, 42, 22, 17, 23, 27, 27, 27, 27, 22, 17, 17, 17, 17, 17, 21, 17, 17, 21, 21, 21, 21, 38, 38, 38, 38, 22, 17, 17, 17, 17, 17, 17, 17, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 27, 27, 43, 43, 43, 43, 43, 43, 43, 42, 17, 17, 17, 22, 22, 26, 22, 22, 22, 22, 22, 22, 22, 22, 22, 43, 43, 43, 26, 17, 22, 22, 22, 22, 22, 
-17, 38, 42, 22, 17, 23, 27, 27, 27, 23, 22, 17, 17, 17, 17, 17, 21, 17, 17, 17, 21, 21, 21, 21, 38, 42, 17, 38, 17, 17, 17, 17, 17, 17, 17, 22, 22, 18, 22, 23, 23, 23, 23, 23, 23, 23, 27, 27, 43, 43, 43, 43, 43, 43, 43, 42, 17, 17, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 27, 27, 43, 43, 43, 22, 22, 22, 22, 22, 22, 22, 
-17, 22, 42, 22, 17, 23, 27, 27, 27, 23, 22, 17, 17, 17, 17, 17, 22, 17, 17, 17, 17, 21, 38, 21, 38, 38, 21, 38, 17, 17, 17, 17, 17, 17, 17, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 27, 27, 43, 43, 43, 43, 43, 43, 43, 47, 21, 17, 22, 26, 26, 22, 22, 22, 22, 22, 22, 27, 43, 43, 43, 43, 22, 22, 22, 22, 22, 22, 22, 22, 
-17, 22, 42, 22, 17, 22, 27, 27, 27, 23, 22, 17, 17, 17, 17, 21, 21, 17, 17, 17, 17, 17, 21, 37, 38, 38, 38, 38, 21, 17, 17, 17, 17, 17, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 27, 43, 43, 43, 43, 43, 43, 43, 43, 42, 17, 22, 26, 22, 22, 22, 22, 22, 22, 22, 43, 43, 43, 43, 27, 22, 22, 22, 22, 22, 22, 22, 22, 
-17, 21, 42, 42, 17, 22, 27, 27, 27, 23, 22, 17, 17, 17, 17, 17, 21, 17, 17, 17, 17, 21, 17, 37, 38, 38, 21, 17, 21, 21, 21, 17, 17, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27, 27, 43, 43, 43, 43, 43, 43, 43, 43, 22, 22, 26, 22, 22, 22, 22, 22, 22, 22, 43, 43, 43, 43, 22, 22, 22, 22, 22, 22, 22, 22, 22, 
-17, 21, 42, 42, 17, 22, 27, 27, 27, 23, 22, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 21, 21, 38, 21, 38, 21, 17, 17, 17, 17, 17, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27, 27, 43, 43, 43, 43, 43, 43, 43, 42, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 27, 43, 27, 22, 22, 22, 22, 22, 22, 22, 22, 22, 
-17, 17, 42, 42, 22, 22, 27, 27, 27, 23, 22, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 21, 38, 21, 17, 21, 21, 17, 17, 17, 17, 17, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27, 27, 43, 43, 43, 43, 43, 43, 43, 43, 22, 22, 22, 22, 22, 22, 22, 22, 26, 22, 43, 43, 22, 22, 22, 22, 22, 22, 22, 22, 22, 17, 
-17, 21, 42, 42, 22, 22, 27, 27, 27, 23, 22, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 21, 38, 38, 22, 17, 17, 17, 17, 17, 18, 22, 22, 22, 18, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27, 27, 43, 43, 43, 43, 43, 43, 43, 22, 22, 22, 22, 21, 17, 17, 22, 27, 27, 43, 27, 22, 18, 22, 22, 22, 22, 22, 22, 22, 17, 
-22, 22, 42, 42, 22, 22, 27, 27, 27, 22, 22, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 21, 38, 22, 17, 17, 17, 17, 17, 22, 22, 18, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27, 27, 43, 43, 43, 43, 43, 43, 42, 22, 22, 22, 22, 21, 17, 22, 43, 27, 26, 22, 17, 18, 22, 22, 22, 22, 22, 22, 21, 17, 
-21, 22, 42, 42, 22, 22, 27, 27, 27, 23, 22, 17, 17, 17, 17, 17, 17, 21, 21, 21, 17, 17, 21, 21, 38, 21, 17, 17, 17, 17, 17, 18, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27, 27, 43, 43, 43, 43, 43, 43, 43, 22, 22, 22, 22, 22, 22, 22, 27, 22, 22, 22, 22, 22, 22, 21, 22, 22, 22, 22, 17, 17, 
-17, 21, 38, 42, 42, 22, 27, 27, 27, 22, 17, 17, 17, 17, 17, 21, 17, 21, 21, 38, 17, 21, 17, 21, 21, 21, 17, 17, 17, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27, 43, 43, 43, 43, 43, 43, 43, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 22, 22, 22, 17, 17, 17, 
-17, 17, 38, 43, 42, 22, 27, 27, 27, 22, 17, 17, 17, 17, 21, 17, 21, 17, 21, 21, 21, 21, 17, 21, 17, 21, 21, 17, 22, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27, 43, 43, 43, 43, 43, 43, 43, 42, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 17, 17, 17, 22
-};
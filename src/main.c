@@ -1,27 +1,85 @@
 #include "stm32f0xx.h"
 #include "stm32f0_discovery.h"
-
-#define WIDTH 80
-#define HEIGHT 60
-
-// load images
-extern char pylogo[];
-extern char lenna[];
-extern char rickslide[];
-
-// allocate screenbuffer
-char screen[HEIGHT][WIDTH + 1];
-
-// flag for the interrupt that triggers when the screen in drawn
-char lendflag = 0;
-
-int curLine = HEIGHT; // start at the end of the buffer because the first line will trigger the interrupt, so it will tick over
-int lastChange = 0;
+#include "vga.h"
+#include "assets.h"
+#include "uart.h"
+#include "flashwriter.h"
+#include "genlock.h"
+#include "audio.h"
+#include "adc.h"
+#include "ps2.h"
+#include "boot.h"
+#include "ram.h"
+#include "draw.h"
+#include "sched.h"
+#include "shell.h"
+#include "anim.h"
+#include "spiflash.h"
+#include "stream.h"
+#include "vq.h"
+#include "packed.h"
+
+// uncomment to show the temporally dithered lenna straight from flash instead of copying an image every frame
+//#define DITHER
+// or this for the 400x100 mono lenna
+//#define MONO
+// or this for the 80x120 lenna in field mode
+//#define FIELDS
+
+#ifdef DITHER
+#define SHOWN_ASSET ASSET_LENNADITHER
+#elif defined(MONO)
+#define SHOWN_ASSET ASSET_LENNAMONO
+#elif defined(FIELDS)
+#define SHOWN_ASSET ASSET_LENNAFIELDS
+#else
+#define SHOWN_ASSET ASSET_RICKSLIDE
+#endif
+
+// uncomment to show a scan-out asset straight from flash as soon as the sync starts, until the rest is set up
+//#define SPLASH ASSET_LENNADITHER
+
+// uncomment to lock the timing to another board's (or any 800x600 60 Hz source's) sync, see inc/genlock.h
+//#define GENLOCK
+// uncomment for sound out of PA4, with a chime at startup and when an asset update finishes (see inc/audio.h)
+//#define AUDIO
+// uncomment to sample an analog stick on PC1 and PC2 every vblank, read with adcRead (see inc/adc.h)
+//#define ANALOG
+// uncomment to echo a PS/2 keyboard on PB8 and PB9 over the UART, with the line interrupt's jitter on enter (see inc/ps2.h)
+//#define KEYBOARD
+// uncomment to print the stack high water mark and heap use over the UART whenever they grow (see inc/ram.h)
+//#define RAMREPORT
+// uncomment to print what each scheduled task costs every 4 seconds or so (see inc/sched.h)
+//#define SCHEDREPORT
+// uncomment to play a video from an SPI NOR flash on SPI2 with the shell's video command (see inc/stream.h)
+//#define NOR
+
+// the asset being shown, or 0 if the asset region doesn't have a valid one
+const assetEntry *image = 0;
+// the one to show, which the shell can change, and go back to after an asset update
+static uint16_t shownId = SHOWN_ASSET;
+
+// frame updates that finished after the first visible line or were missed altogether, and the frame of the last one
+static uint32_t framesLate = 0;
+static unsigned int updatedFrame = 0;
+// DMA transfers that hit a bad address, which also stops the channel
+static uint32_t dmaErrors = 0;
+#ifdef NOR
+// what the SPI flash answered to read JEDEC ID, 0 or 0xFFFFFF if nothing's there
+static uint32_t norId = 0;
+#endif
+
+// field mode: which field the screen buffer rows are being refilled for, and the next row to refill
+static unsigned int fillField = 0;
+static int fillSlot = 0;
 
 /*
  * change the system's clock frequency to 40 MHz
  */
 void changeClockFreq() {
+	// SystemInit normally has it running at 40 MHz already, and locking the PLL again would only slow the boot down
+	if((RCC->CFGR & RCC_CFGR_SWS) == RCC_CFGR_SWS_PLL && (RCC->CFGR & RCC_CFGR_PLLMULL) == (0x8 << 18))
+		return;
 	// directly lifted from A.3.2 of the Family reference (Page 940)
 	if ((RCC->CFGR & RCC_CFGR_SWS) == RCC_CFGR_SWS_PLL)
 	{
@@ -53,212 +111,530 @@ void changeClockFreq() {
 }
 
 /*
- * Update the DMA request address after each line
+ * copy an indexed image into the screen buffer
+ * this is fast enough to start right after the vblank interrupt and stay ahead of the beam
+ */
+void copyImage(const char *pixels) {
+	for(int y = 0; y < HEIGHT; y++) {
+		for(int x = 0; x < WIDTH; x++) {
+			screen.color[y][x] = pixels[y * WIDTH + x];
+		}
+	}
+}
+
+/*
+ * copy one row of a 2 * HEIGHT row image into a row of the screen buffer
+ */
+static void copyRow(const char *pixels, int slot, int row) {
+	for(int x = 0; x < WIDTH; x++) {
+		screen.color[slot][x] = pixels[row * WIDTH + x];
+	}
+}
+
+/*
+ * Keep the screen buffer ahead of the beam in field mode
+ * Row k of the buffer shows row 2k of the image in even frames and row 2k + 1 in odd ones, so as soon as the current
+ * field is done with a row it gets the one the next field shows there. Called every time the main loop wakes up,
+ * which is at least once a line, and a row only takes a few hundred cycles to copy
+ */
+void renderFields(const char *pixels) {
+	unsigned int showing = frameCount & 1;
+	if(fillField == showing) {
+		// a new field has started: the row the last one was still showing at the bottom hasn't been refilled yet
+		for(; fillSlot < HEIGHT; fillSlot++)
+			copyRow(pixels, fillSlot, 2 * fillSlot + fillField);
+		fillField = !showing;
+		fillSlot = 0;
+	}
+	int done = fieldSlotsDone();
+	for(; fillSlot < done; fillSlot++)
+		copyRow(pixels, fillSlot, 2 * fillSlot + fillField);
+}
+
+/*
+ * look up an asset and start showing it
+ * indexed images get copied into the screen buffer every frame, scan-out and mono frames are read by the DMA
+ * straight from flash (and if there are two of them, dithered between), and field images are copied in a row
+ * at a time as the beam goes (see renderFields)
+ */
+void showAsset(uint16_t id) {
+	animStop();
+	streamStop();
+	image = assetFind(id);
+	// if the asset region is missing or corrupt, the asset doesn't fit this screen, or it was made for a different DAC,
+	// leave the screen as it is rather than showing garbage (assetCheck also checks its size, see assetValid)
+	if(image && (image->palette != PALETTE || !assetCheck(image)))
+		image = 0;
+	if(!image)
+		return;
+
+	if(image->format == ASSET_FORMAT_VQ || image->format == ASSET_FORMAT_PACKED) {
+		// decoded once, the first frame if it's a clip (play animates it)
+		ditherFrames[0] = 0;
+		ditherFrames[1] = 0;
+		if(image->format == ASSET_FORMAT_VQ) {
+			vqDecodeRows((const vqHeader *) assetData(image), vqFrame(image, 0), 0, HEIGHT);
+		} else {
+			packedDecodeRows((const packedHeader *) assetData(image), packedFrame(image, 0), 0, HEIGHT);
+		}
+		frame = screen.color[0];
+	} else if(image->format == ASSET_FORMAT_INDEXED || image->format == ASSET_FORMAT_FIELDS) {
+		ditherFrames[0] = 0;
+		ditherFrames[1] = 0;
+		// the screen buffer might not hold a picture yet (it isn't cleared at reset), so fill it before it's shown
+		if(image->format == ASSET_FORMAT_INDEXED) {
+			copyImage(assetData(image));
+		} else {
+			// the rows for the field that's about to start, then renderFields keeps it going
+			fillField = frameCount & 1;
+			for(fillSlot = 0; fillSlot < HEIGHT; fillSlot++)
+				copyRow(assetData(image), fillSlot, 2 * fillSlot + fillField);
+		}
+		frame = screen.color[0];
+	} else {
+		ditherFrames[0] = assetData(image);
+		ditherFrames[1] = ditherFrames[0] + (image->frames > 1 ? image->length / image->frames : 0);
+		frame = ditherFrames[0];
+	}
+	if(image->format == ASSET_FORMAT_FIELDS) {
+		setVideoMode(VIDEO_FIELDS);
+	} else {
+		setVideoMode(image->format == ASSET_FORMAT_MONO ? VIDEO_MONO : VIDEO_COLOR);
+	}
+	bootPictureReady();
+}
+
+/*
+ * stop reading from the asset region because it's about to be rewritten, keeping the current picture in the screen buffer
+ */
+void releaseAsset() {
+	if(image && image->format == ASSET_FORMAT_FIELDS) {
+		setVideoMode(VIDEO_COLOR); // the buffer holds rows from both fields, which is close enough to the picture
+	} else if(image && (image->format == ASSET_FORMAT_SCANOUT || image->format == ASSET_FORMAT_MONO)) {
+		const char *shown = frame;
+		char *copy = (char *) &screen;
+		for(uint32_t i = 0; i < image->length / image->frames; i++) {
+			copy[i] = shown[i];
+		}
+		ditherFrames[0] = 0;
+		ditherFrames[1] = 0;
+		frame = copy;
+	}
+	image = 0;
+}
+
+/*
+ * hand the screen buffer to the drawing commands: stop showing the asset, keeping its picture if it's a colour one
+ * that's already in the buffer, and otherwise start from a black screen
  */
-void TIM3_IRQHandler() {
-	GPIOC->ODR |= 0x1;
-	TIM3->SR &= ~TIM_SR_CC3IF;
-	lastChange++;
-	if(lastChange >= 10) {
-		// If you don't disable the DMA request, it will immediately do a transfer when enabled
-		TIM15->DIER = 0;
-		DMA1_Channel5->CCR &= ~DMA_CCR_EN; // disable the DMA channel
-		// check if we're in the visible region of the vertical sweep
-		// remember that TIM2 also counts at the pixel clock, so multiply the line numbers by 1056
-		if((TIM2->CNT > 27 * 1056) && (TIM2->CNT < 627 * 1056)) {
-			lastChange = 0;
-			curLine += 1;
-			if(curLine >= HEIGHT)
-				curLine = 0;
-
-			DMA1_Channel5->CMAR = (int)&(screen[curLine]); // change it to a new address
-			DMA1_Channel5->CCR |= DMA_CCR_EN; // re-enable the DMA channel
-			TIM15->DIER = TIM_DIER_CC1DE;
+void takeScreen() {
+	animStop();
+	streamStop();
+	if(image)
+		releaseAsset();
+	if(videoMode == VIDEO_COLOR && frame == screen.color[0])
+		return;
+	setVideoMode(VIDEO_COLOR);
+	for(int y = 0; y < HEIGHT; y++) {
+		for(int x = 0; x <= WIDTH; x++) {
+			screen.color[y][x] = 0; // the edge pixels too
 		}
 	}
-	GPIOC->ODR &= ~(0x1);
+	ditherFrames[0] = 0;
+	ditherFrames[1] = 0;
+	frame = screen.color[0];
 }
 
 /*
- * handler called immediately after the frame has finished drawing
- * just sets a flag because we shouldn't spend a long time processing in an interrupt
- * TODO: could do this as a DMA request, but that's less flexible
- * this sets us up nicely for 'racing the beam'.
- * You have a buffer of 29,568 clock cycles of buffer between this interrupt starting to be triggered and the first pixel being drawn
- * then you have 10 clock cycles per pixel + 256 clock cycles at the end of each line (minus the TIM3 interrupt code)
- * total, there are 663,168 clock cycles until this triggers again
+ * the work done every time the main loop wakes up, which is at least once a line
  */
-void TIM2_IRQHandler() {
-	TIM2->SR &= ~TIM_SR_CC3IF;
-	lendflag = 1;
+void updateLine() {
+	if(image && image->format == ASSET_FORMAT_FIELDS)
+		renderFields(assetData(image));
+	animLine();
+	streamLine();
 }
 
 /*
- * Setup Tim3 to output the hsync signal to A7
- * Also Tim15 is the pixel clock, and outputs it to A2 for reference
- * Tim15 does a DMA request to copy each pixel to GPIOB so it can drive the DAC
+ * the work done once per frame, in the vblank after the frame has finished drawing
+ * this has to be done before the first visible line or the top of the picture tears (see m0sim/scanout.py)
  */
-void setupHorizontalTimers() {
-	/*
-	 * What we want to generate (in pixel clock units: 40 MHz):
-	 * |    800    |  40  |   128   |  88 |
-	 *                     _________
-	 * ___________________|         |______
-	 * |pixels here|
-	 *
-	 * If we rearrange a little (because it doesn't matter where the timer starts):
-	 * |   128   |  88 |    800    |  40  |
-	 *  _________
-	 * |         |_________________________
-	 *                 |pixels here|
-	 *
-	 * Note: It is important that the pixel lines are all LOW when we are outside of the pixel region
-	 * At least some monitors (like mine) use that as an important sync clue.
-	 * As such, we will use an extra pixel at the end of each sync line to reset the line to 0
-	 *
-	 * How we generate this: 2 timers
-	 *
-	 * Tim3 is the master timer:
-	 *     counts at 40 MHZ, the system clock
-	 *     CCx2 is the hsync pulse output:
-	 *         PWM mode one, outputs high until 128 pixel clocks then low until restart
-	 *     CCx1 is the pixel trigger:
-	 * 	       Mode doesn't really matter, its only here to send the master mode output at the compare value
-	 *     	   Set compare to 128+88=216.
-	 * 	       Set Master Mode Selection to Compare Pulse, so it sends a pulse at 216 pixel clocks
-	 * 	   CCx3 triggers an interrupt right after the pixels finish outputting
-	 * 	       This is primarily to keep the DMA address up to date, but might also be good for synchronizing screen updates
-	 *
-	 * Tim15 is the pixel timer:
-	 *     Fires an update event at the actual pixel output clock (so 4 MHz)
-	 *     Uses the Repeat counter to output the appropriate number of pixels (80)
-	 *     Triggers a DMA request channel 5 on every update event
-	 *     Slave mode triggered from Tim2
-	 *
-	 */
-
-	// first lets set up the master timer (TIM3)
-
-	GPIOA->MODER |= (0x2 << (2 * 7)); // A7 alternate function
-	GPIOA->AFR[0] |= (0x1 << (4 * 7)); // AF1 == TIM3_CH2
-
-	// count the whole line (1056 long) at the system clock (40 MHz)
-	TIM3->PSC = 0;
-	TIM3->ARR = 1055;
-
-	// configure Capture/Compare channel 2
-	// bits 4:6 are mode
-	// 0x6 is PWM1 (high while count is below this value)
-	TIM3->CCMR1 |= ((0x6 << 4)) << 8;
-	TIM3->CCR2 = 128;
-	TIM3->CCER |= TIM_CCER_CC2E;
-
-	// configure CCx1, mode doesn't matter so leave it 0
-	// should be 216, but again it's kinda slow so add a fudge factor to make the timings work
-	TIM3->CCR1 = 216 - 7;
-	TIM3->CCER |= TIM_CCER_CC1E;
-
-	// CR2_MMS = 0x3 is CC1IF flag set (pulse when CCx1 matches)
-	TIM3->CR2 |= 0x3 << 4;
-
-	// configure CCx3 for the end of the pixel output region
-	// should be 1016, but it takes several clock cycles for the interrupt to actually trigger, so use a fudge factor for more time before the next line starts
-	// again, mode doesn't matter
-	TIM3->CCR3 = 1016 - 32;
-	TIM3->CCER |= TIM_CCER_CC3E;
-
-	TIM3->DIER |= TIM_DIER_CC3IE; // enable the interrupt on CCx3 so that we can get the max number of cycles after the pixels are done
-	NVIC->ISER[0] |= 1 << TIM3_IRQn; // enable the interrupt for real
-	NVIC_SetPriority(TIM3_IRQn, 3); // set it to the highest priority
-
-	// now set up the pixel TIM15
-
-	// tim15 ccr1 outputs on PA2 with AF0 (just for making sure pixel clock is right)
-	GPIOA->MODER |= 0x2 << (2 * 2);
-
-	TIM15->PSC = 0;
-	TIM15->ARR = 9; // should create 4MHz update events
-
-	// set the RCR to only send an update event after 81 timer resets (80 screen pixels + 1 edge pixel)
-	TIM15->RCR = 81 - 1;
-
-	TIM15->EGR = TIM_EGR_UG; // apparently you need to generate an update event to make this kick in
-
-	// use PWM mode 1 with CCR1 set to 1 to generate a pulse on every reset.
-	TIM15->CCMR1 |= 0x6 << 4;
-	TIM15->CCR1 = 1;
-
-	TIM15->CCER |= TIM_CCER_CC1E;
-
-	// set up DMA request generation from CCx1 since the update events are inhibited by the RCR
-	// triggers DMA channel 1
-	TIM15->DIER |= TIM_DIER_CC1DE;
-
-	// set it to one pulse mode, but because RCR doesn't allow update for 80 overflows, it becomes 80 pulse mode
-	TIM15->CR1 |= TIM_CR1_OPM;
-
-	// enable the master outputs
-	TIM15->BDTR |= TIM_BDTR_MOE;
-
-	// set up slave mode to be triggered from the output of TIM3
-	TIM15->SMCR |= 0x1 << 4; // trigger select 1 is TIM3
-	TIM15->SMCR |= 0x6; // slave mode select 6 is 'trigger mode' (start counter at rising edge)
-
-	// set up DMA channel 5:
-	// transfers one byte from memory to GPIOB->ODR, increment 80 times then circle
-	DMA1_Channel5->CCR |=
-			DMA_CCR_PL |       // set it to the highest priority
-			DMA_CCR_MINC |     // increment memory address
-			DMA_CCR_CIRC |     // enable circular mode
-			DMA_CCR_DIR;       // transfer memory -> peripheral
-	DMA1_Channel5->CNDTR = 81; // transfer 81 elements before circling back
-	DMA1_Channel5->CPAR = (int) &(GPIOB->ODR);
-	DMA1_Channel5->CMAR = (int) screen;
-
-	// set up GPIOB to output on pins 0..7
-	for(int i = 0; i < 8; i++)
-		GPIOB->MODER |= (0x1 << 2 * i);
+void updateFrame() {
+	if(flashWriterActive()) {
+		// the asset region is being rewritten, so keep showing what's in the screen buffer and spend the vblank on flash
+		releaseAsset();
+		animStop();
+		streamStop();
+		flashWriterRun();
+	} else if(image && image->format == ASSET_FORMAT_INDEXED) {
+		copyImage(assetData(image));
+	} else {
+		animUpdate();
+		streamUpdate();
+	}
+	if(drawPending()) { // after everything else, since it only runs what still fits in the vblank
+		takeScreen();
+		drawRun();
+	}
+	genlockUpdate();
+
+	if(!vblankCyclesLeft())
+		framesLate++;
+	if(frameCount - updatedFrame > 1)
+		framesLate += frameCount - updatedFrame - 1;
+	updatedFrame = frameCount;
 }
 
 /*
- * Setup Tim2 to drive A1 to be the vsync signal
+ * count the DMA channels' transfer errors since the last check
  */
-void setupVerticalTimer() {
-	/*
-	 * TIM2 is the timer for the vsync signal. We're going to use the same trick as TIM2 to rearrange the signal
-	 * into something easily PWM1able.
-	 * |    4    |  23 |    600    |   1   | (in units of lines)
-	 *  _________
-	 * |         |__________________________
-	 *                 |pixels here|
-	 * The only difference is that the timer counts 1055 times slower (since it counts once per horizontal line)
-	 * TODO: I don't actually know what the timing between the hsync and vsync signal should be
-	 */
-
-	GPIOA->MODER |= (0x2 << (2 * 1)); // A1 alternate function
-	GPIOA->AFR[0] |= (0x2 << (4 * 1)); // AF2 == TIM2_CH2
-
-	// count the whole line (628 long) at the horizontal line clock (1056x slower than the system clock)
-	// note that using the prescaler seems to enforce a phase between it and the system clock
-	// so we're using the infinite power of the 32 bit timer for this
-	TIM2->PSC = 0;
-	TIM2->ARR = (628 * 1056) - 1;
-
-	// configure Capture/Compare channel 2
-	// bits 4:6 are mode
-	// 0x6 is PWM1 (high while count is below this value)
-	TIM2->CCMR1 |= (0x6 << 4) << 8;
-	TIM2->CCR2 = 4 * 1056;
-	TIM2->CCER |= TIM_CCER_CC2E;
-
-	// add a screen refresh interrupt that triggers immediately after the visible region of the screen is drawn
-	TIM2->CCR3 = 1056 * 627;
-	TIM2->CCER |= TIM_CCER_CC3E;
-	TIM2->DIER |= TIM_DIER_CC3IE;
-	NVIC->ISER[0] |= 1 << TIM2_IRQn;
-	NVIC_SetPriority(TIM2_IRQn, 0); // set it to low priority
+void countDmaErrors() {
+	uint32_t errors = DMA1->ISR & (DMA_ISR_TEIF1 | DMA_ISR_TEIF2 | DMA_ISR_TEIF3 | DMA_ISR_TEIF4 | DMA_ISR_TEIF5);
+	DMA1->IFCR = errors; // the clear bits are in the same places
+	for(; errors; errors >>= 4)
+		dmaErrors += (errors >> 3) & 1;
+}
+
+#define FORMATS 6
+static const char *const formatNames[FORMATS] = {"color", "scanout", "mono", "fields", "vq", "packed"};
+static const char *const modeNames[] = {"color", "mono", "fields"}; // by VIDEO_*
+
+// the video mode an asset format is shown in
+static uint8_t formatMode(uint8_t format) {
+	if(format == ASSET_FORMAT_MONO)
+		return VIDEO_MONO;
+	return format == ASSET_FORMAT_FIELDS ? VIDEO_FIELDS : VIDEO_COLOR;
 }
 
+// whether showAsset would show it
+static int canShow(const assetEntry *asset) {
+	return asset && asset->palette == PALETTE && assetCheck(asset);
+}
+
+// whether the shell can touch the assets, which it can't while they're being rewritten
+static int assetsReady() {
+	if(flashWriterActive()) {
+		uartPrint("? the assets are being updated\n");
+		return 0;
+	}
+	return 1;
+}
+
+/*
+ * list the assets: id, size, frames, format, whether they can be shown here, and a * for the one being shown
+ */
+void shellList(const char *args) {
+	const assetEntry *asset;
+	if(!assetsReady())
+		return;
+	if(!assetAt(0))
+		uartPrint("? no assets\n");
+	for(uint32_t i = 0; (asset = assetAt(i)); i++) {
+		uartPrintNum(asset->id);
+		uartWrite(' ');
+		uartPrintNum(asset->width);
+		uartWrite('x');
+		uartPrintNum(asset->height);
+		uartWrite(' ');
+		uartPrintNum(asset->frames);
+		uartWrite(' ');
+		uartPrint(asset->format < FORMATS ? formatNames[asset->format] : "?");
+		uartPrint(canShow(asset) ? " ok" : " bad");
+		uartPrint(asset == image ? " *\n" : "\n");
+	}
+}
+
+void shellShow(const char *args) {
+	uint32_t id;
+	if(!shellNumber(&args, &id)) {
+		uartPrint("? show id\n");
+		return;
+	}
+	if(!assetsReady())
+		return;
+	if(!canShow(assetFind(id))) {
+		uartPrint("? no asset that can be shown with that id\n");
+		return;
+	}
+	shownId = id;
+	showAsset(id);
+	uartPrint("ok\n");
+}
+
+/*
+ * show the first asset that's in the mode
+ */
+void shellMode(const char *args) {
+	int mode;
+	for(mode = 0; mode < 3; mode++) {
+		if(shellWord(&args, modeNames[mode]))
+			break;
+	}
+	if(mode == 3) {
+		uartPrint("? mode color|mono|fields\n");
+		return;
+	}
+	if(!assetsReady())
+		return;
+	const assetEntry *asset;
+	for(uint32_t i = 0; (asset = assetAt(i)); i++) {
+		if(formatMode(asset->format) != mode || !canShow(asset))
+			continue;
+		shownId = asset->id;
+		showAsset(asset->id);
+		uartPrint("showing ");
+		uartPrintNum(asset->id);
+		uartWrite('\n');
+		return;
+	}
+	uartPrint("? no asset for that mode\n");
+}
+
+void shellStats(const char *args) {
+	uartPrint("frames ");
+	uartPrintNum(frameCount);
+	uartPrint(" late ");
+	uartPrintNum(framesLate);
+	uartPrint("\nline isr latency ");
+	uartPrintNum(lineLatencyMin);
+	uartPrint("..");
+	uartPrintNum(lineLatencyMax);
+	uartPrint(" cycles\ndma errors ");
+	uartPrintNum(dmaErrors);
+	uartPrint("\nstack ");
+	uartPrintNum(ramStackUsed());
+	uartPrint(" heap ");
+	uartPrintNum(heapPeak);
+	uartPrint(" free ");
+	uartPrintNum(ramHeadroom());
+	uartPrint(" bytes\nuart dropped ");
+	uartPrintNum(uartDropped);
+	uartPrint("\nanimation shown ");
+	uartPrintNum(animShown);
+	uartPrint(" late ");
+	uartPrintNum(animLate);
+	uartPrint(" dropped ");
+	uartPrintNum(animDropped);
+#ifdef NOR
+	uartPrint("\nvideo shown ");
+	uartPrintNum(streamShown);
+	uartPrint(" late ");
+	uartPrintNum(streamLate);
+	uartPrint(" dropped ");
+	uartPrintNum(streamDropped);
+	uartPrint(", spi flash id ");
+	uartPrintNum(norId);
+#endif
+	uartWrite('\n');
+}
+
+#define PLAY_MAX 8
+static animFrame playList[PLAY_MAX];
+
+/*
+ * play id:frames ... [loop]
+ */
+void shellPlay(const char *args) {
+	animFrame list[PLAY_MAX];
+	uint32_t id, frames;
+	int count = 0;
+	while(count < PLAY_MAX && shellNumber(&args, &id)) {
+		frames = 1;
+		if(*args == ':') {
+			args++;
+			if(!shellNumber(&args, &frames))
+				break;
+		}
+		list[count].asset = id;
+		list[count].frames = frames;
+		count++;
+	}
+	int loop = shellWord(&args, "loop");
+	if(!count || *args) {
+		uartPrint("? play id:frames ... [loop]\n");
+		return;
+	}
+	if(!assetsReady())
+		return;
+
+	animStop(); // before its list is overwritten
+	streamStop();
+	for(int i = 0; i < count; i++)
+		playList[i] = list[i];
+	releaseAsset();
+	if(videoMode != VIDEO_COLOR) {
+		setVideoMode(VIDEO_COLOR);
+		frame = 0; // black until the first image is revealed
+	}
+	uartPrint(animStart(playList, count, loop) ? "ok\n" : "? those can't all be played\n");
+}
+
+#ifdef NOR
+/*
+ * video [loop]
+ */
+void shellVideo(const char *args) {
+	int loop = shellWord(&args, "loop");
+	if(*args) {
+		uartPrint("? video [loop]\n");
+		return;
+	}
+	animStop();
+	streamStop();
+	if(!streamOpen(0)) {
+		uartPrint("? no video in the spi flash for this DAC\n");
+		return;
+	}
+	releaseAsset();
+	if(videoMode != VIDEO_COLOR) {
+		setVideoMode(VIDEO_COLOR);
+		frame = 0; // black until the first frame is revealed
+	}
+	streamStart(loop);
+	uartPrint("ok\n");
+}
+#endif
+
+void shellStop(const char *args) {
+	animStop();
+	streamStop();
+	uartPrint("ok\n");
+}
+
+/*
+ * start the counters that can go down again afresh
+ */
+void shellClear(const char *args) {
+	framesLate = 0;
+	dmaErrors = 0;
+	animLate = 0;
+	animDropped = 0;
+	streamLate = 0;
+	streamDropped = 0;
+	lineLatencyMin = 0xFFFF;
+	lineLatencyMax = 0;
+	uartPrint("ok\n");
+}
+
+static const shellCommand commands[] = {
+	{"list", "list             the assets: id, size, frames, format, ok if it can be shown, * if it is", shellList},
+	{"show", "show id          show an asset", shellShow},
+	{"mode", "mode color|mono|fields  show the first asset in that video mode", shellMode},
+	{"play", "play id:frames ... [loop]  play colour assets and clips, each picture for a number of frames", shellPlay},
+#ifdef NOR
+	{"video", "video [loop]     play the video in the SPI flash", shellVideo},
+#endif
+	{"stop", "stop             stop playing, leaving the picture up", shellStop},
+	{"stats", "stats            frames shown and late, line interrupt latency, DMA errors, RAM use, animation", shellStats},
+	{"clear", "clear            zero the late and dropped counts, latency and DMA errors", shellClear},
+};
+
+/*
+ * print it over the UART when genlock locks or loses the lock, with how long it took and the phase error
+ * this blocks for a few ms, so the next frame might tear, but it only happens when the sync changes
+ */
+void reportGenlock() {
+	static uint8_t reported = GENLOCK_OFF;
+	if(genlockState == reported || flashWriterActive()) // don't talk over the flash writer's replies
+		return;
+	reported = genlockState;
+	if(reported == GENLOCK_LOCKED) {
+		uartPrint("genlock: locked in ");
+		uartPrintNum(genlockLockFrames);
+		uartPrint(" frames, line error ");
+		uartPrintInt(genlockLineError);
+		uartPrint(", frame error ");
+		uartPrintInt(genlockFrameError);
+		uartPrint(" cycles\n");
+	} else if(reported == GENLOCK_SEARCHING) {
+		uartPrint("genlock: searching\n");
+	}
+}
+
+#ifdef RAMREPORT
+/*
+ * print the RAM use when the stack has gone deeper or the heap bigger than last time, checked once a second
+ * scanning the painted RAM takes a few thousand cycles, which is why it isn't every frame
+ */
+void reportRam() {
+	static uint32_t reportedStack = 0, reportedHeap = 0;
+	if(flashWriterActive())
+		return;
+	uint32_t stack = ramStackUsed();
+	if(stack <= reportedStack && heapPeak <= reportedHeap)
+		return;
+	reportedStack = stack;
+	reportedHeap = heapPeak;
+	ramReport();
+}
+#endif
+
+#ifdef KEYBOARD
+/*
+ * echo what's typed, and on enter how much the line interrupt's start has moved about since the last time
+ */
+void echoKeys() {
+	int c;
+	while((c = ps2ReadKey()) >= 0) {
+		uartWrite(c);
+		if(c != '\n')
+			continue;
+		uartPrint("line isr latency ");
+		uartPrintNum(lineLatencyMin);
+		uartPrint("..");
+		uartPrintNum(lineLatencyMax);
+		uartPrint(" cycles, ");
+		uartPrintNum(ps2Errors);
+		uartPrint(" bad scancodes\n");
+		lineLatencyMin = 0xFFFF;
+		lineLatencyMax = 0;
+	}
+}
+
+void keyboardTask() {
+	ps2Update();
+	echoKeys();
+}
+#endif
+
+#ifdef SCHEDREPORT
+void reportTasks() {
+	if(!flashWriterActive())
+		schedReport();
+}
+#endif
+
+#ifdef AUDIO
+/*
+ * a short two note chord, for when something's done
+ */
+void chime() {
+	audioTone(0, audioSine, 660, 100, 150);
+	audioTone(1, audioSine, 880, 100, 150);
+}
+#endif
+
+// the application's work, run wherever the beam leaves room for it (see inc/sched.h)
+static schedTask tasks[] = {
+	{.name = "genlock", .run = reportGenlock, .period = 1, .cost = 500},
+	{.name = "dma", .run = countDmaErrors, .period = 1, .cost = 100},
+	// replies don't wait on the UART (see inc/shell.h), so the most it takes is list checking every asset's CRC
+	{.name = "shell", .run = shellRun, .period = 0, .cost = 60000},
+#ifdef AUDIO
+	// the samples for the next frame, which don't need to be done before the first visible line
+	{.name = "audio", .run = audioFill, .period = 1, .cost = 40000},
+#endif
+#ifdef KEYBOARD
+	{.name = "keyboard", .run = keyboardTask, .period = 1, .cost = 2000},
+#endif
+#ifdef RAMREPORT
+	{.name = "ram", .run = reportRam, .period = 60, .cost = 10000},
+#endif
+#ifdef SCHEDREPORT
+	{.name = "tasks", .run = reportTasks, .period = 255, .cost = 400000},
+#endif
+};
+
 int main(void) {
 	changeClockFreq(); // set the system clock to 40 MHz (the frequency of the VGA clock)
 
@@ -268,31 +644,69 @@ int main(void) {
 	RCC->AHBENR |= RCC_AHBENR_GPIOAEN;
 	RCC->AHBENR |= RCC_AHBENR_GPIOBEN;
 	RCC->AHBENR |= RCC_AHBENR_DMA1EN;
-	RCC->AHBENR |= RCC_APB2ENR_SYSCFGEN;
+	RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;
+	RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
+
+	// start the sync before anything else so the monitor can start locking on. Nothing is scanned out until showAsset
+	// gives the DMA a frame, since the screen buffer isn't cleared at reset
+	setupHorizontalTimers(); // configure TIM3 to generate the HSYNC signal, and TIM15 to trigger DMA requests for signal output
+	setupVerticalTimer(); // configure TIM2 to generate the VSYNC signal
+	TIM2->CR1 |= TIM_CR1_CEN;
+	TIM3->CR1 |= TIM_CR1_CEN;
+	bootSyncStarted();
+	ramPaintStack(); // as early as possible, so the high water mark covers nearly everything
+#ifdef SPLASH
+	showAsset(SPLASH);
+#endif
+
+	relocateVectors(); // so the video interrupts never have to wait on flash
+	uartInit();
 
 	RCC->AHBENR |= RCC_AHBENR_GPIOCEN;
 	GPIOC->MODER |= 0x1;
 
-	setupHorizontalTimers(); // configure TIM3 to generate the HSYNC signal, and TIM15 to trigger DMA requests for signal output
-	setupVerticalTimer(); // configure TIM2 to generate the VSYNC signal
+#ifdef AUDIO
+	audioInit(); // TIM3 moves a sample from RAM to the DAC at the start of every line
+	chime();
+#endif
+#ifdef ANALOG
+	adcInit(ADC_JOYSTICK, 2); // TIM2 starts 4 scans of it at the start of every vblank
+#endif
+#ifdef KEYBOARD
+	ps2Init();
+#endif
+#ifdef NOR
+	norId = spiFlashInit(); // SPI2 and DMA channel 4 bring video frames in from it
+#endif
 
 	// load the right edge fake pixels with 0. They must always remain ZERO
 	for(int y = 0; y < HEIGHT; y++) {
-		screen[y][WIDTH] = 0;
+		screen.color[y][WIDTH] = 0;
 	}
 
-	TIM2->CR1 |= TIM_CR1_CEN;
-	TIM3->CR1 |= TIM_CR1_CEN;
+	showAsset(shownId);
+#ifdef GENLOCK
+	genlockStart(0);
+#endif
+	bootReport();
+	schedInit(tasks, sizeof(tasks) / sizeof(tasks[0]));
+	shellInit(commands, sizeof(commands) / sizeof(commands[0]));
+	updatedFrame = frameCount;
 
 	for(;;) {
 		asm("wfi"); // wait for an interrupt to be triggered
+		if(flashWriterPoll()) { // an asset update just finished
+			showAsset(shownId);
+#ifdef AUDIO
+			chime();
+#endif
+		}
+		updateLine();
+
 		if(lendflag) { // if we just finished drawing a frame
-			for(int y = 0; y < HEIGHT; y++) {
-				for(int x = 0; x < WIDTH; x++) {
-					screen[y][x] = rickslide[y * WIDTH + x];
-				}
-			}
+			updateFrame();
 			lendflag = 0; // we're done drawing the frame
 		}
+		schedRun();
 	}
 }
@@ -0,0 +1,61 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "assets.h"
+#include "packed.h"
+
+static int frameSize(const packedHeader *packed) {
+	return WIDTH * HEIGHT * packed->bits / 8;
+}
+
+/*
+ * whether an asset is a packed picture of the screen's size whose length adds up
+ */
+int packedValid(const assetEntry *asset) {
+	if(!asset || asset->format != ASSET_FORMAT_PACKED || asset->width != WIDTH || asset->height != HEIGHT)
+		return 0;
+	const packedHeader *packed = (const packedHeader *) assetData(asset);
+	if(asset->length < sizeof(packedHeader) || (packed->bits != 2 && packed->bits != 4))
+		return 0;
+	return asset->length == sizeof(packedHeader) + asset->frames * frameSize(packed);
+}
+
+/*
+ * the pixels of one frame
+ */
+const uint8_t *packedFrame(const assetEntry *asset, int frame) {
+	const packedHeader *packed = (const packedHeader *) assetData(asset);
+	return (const uint8_t *) (packed + 1) + frame * frameSize(packed);
+}
+
+/*
+ * Decode rows row up to last of a frame into the screen buffer, returning last
+ * The palette is looked up in a copy on the stack, which saves the flash wait state on every pixel
+ */
+int packedDecodeRows(const packedHeader *packed, const uint8_t *pixels, int row, int last) {
+	uint8_t palette[16];
+	for(int i = 0; i < 16; i++)
+		palette[i] = packed->palette[i];
+	int rowBytes = WIDTH * packed->bits / 8;
+	pixels += row * rowBytes;
+	for(; row < last; row++) {
+		char *out = screen.color[row];
+		if(packed->bits == 4) {
+			for(int x = 0; x < rowBytes; x++) {
+				uint8_t b = *pixels++;
+				out[0] = palette[b >> 4];
+				out[1] = palette[b & 0xF];
+				out += 2;
+			}
+		} else {
+			for(int x = 0; x < rowBytes; x++) {
+				uint8_t b = *pixels++;
+				out[0] = palette[b >> 6];
+				out[1] = palette[(b >> 4) & 0x3];
+				out[2] = palette[(b >> 2) & 0x3];
+				out[3] = palette[b & 0x3];
+				out += 4;
+			}
+		}
+	}
+	return row;
+}
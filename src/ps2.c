@@ -0,0 +1,151 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "ps2.h"
+
+volatile uint32_t ps2Errors = 0;
+
+// scancodes, filled by the interrupt and drained by ps2Update
+#define CODE_SIZE 16 // must be a power of two
+static volatile uint8_t codes[CODE_SIZE];
+static volatile uint8_t codeHead = 0;
+static volatile uint8_t codeTail = 0;
+
+// the frame being shifted in, LSB (the start bit) first
+static uint16_t ps2Frame = 0;
+static int ps2BitCount = 0;
+static uint16_t ps2LastEdge = 0;
+
+// decoded characters, filled and drained by the main loop
+#define KEY_SIZE 16 // must be a power of two
+static uint8_t keys[KEY_SIZE];
+static uint8_t keyHead = 0;
+static uint8_t keyTail = 0;
+
+// scancode set 2 (what every keyboard sends by default) to characters, 0 for keys that aren't one
+static const char unshifted[0x80] = {
+	[0x0D] = '\t', [0x0E] = '`', [0x15] = 'q', [0x16] = '1', [0x1A] = 'z', [0x1B] = 's', [0x1C] = 'a', [0x1D] = 'w',
+	[0x1E] = '2', [0x21] = 'c', [0x22] = 'x', [0x23] = 'd', [0x24] = 'e', [0x25] = '4', [0x26] = '3', [0x29] = ' ',
+	[0x2A] = 'v', [0x2B] = 'f', [0x2C] = 't', [0x2D] = 'r', [0x2E] = '5', [0x31] = 'n', [0x32] = 'b', [0x33] = 'h',
+	[0x34] = 'g', [0x35] = 'y', [0x36] = '6', [0x3A] = 'm', [0x3B] = 'j', [0x3C] = 'u', [0x3D] = '7', [0x3E] = '8',
+	[0x41] = ',', [0x42] = 'k', [0x43] = 'i', [0x44] = 'o', [0x45] = '0', [0x46] = '9', [0x49] = '.', [0x4A] = '/',
+	[0x4B] = 'l', [0x4C] = ';', [0x4D] = 'p', [0x4E] = '-', [0x52] = '\'', [0x54] = '[', [0x55] = '=', [0x5A] = '\n',
+	[0x5B] = ']', [0x5D] = '\\', [0x66] = PS2_KEY_BACKSPACE, [0x76] = PS2_KEY_ESCAPE,
+};
+
+static const char shifted[0x80] = {
+	[0x0D] = '\t', [0x0E] = '~', [0x15] = 'Q', [0x16] = '!', [0x1A] = 'Z', [0x1B] = 'S', [0x1C] = 'A', [0x1D] = 'W',
+	[0x1E] = '@', [0x21] = 'C', [0x22] = 'X', [0x23] = 'D', [0x24] = 'E', [0x25] = '$', [0x26] = '#', [0x29] = ' ',
+	[0x2A] = 'V', [0x2B] = 'F', [0x2C] = 'T', [0x2D] = 'R', [0x2E] = '%', [0x31] = 'N', [0x32] = 'B', [0x33] = 'H',
+	[0x34] = 'G', [0x35] = 'Y', [0x36] = '^', [0x3A] = 'M', [0x3B] = 'J', [0x3C] = 'U', [0x3D] = '&', [0x3E] = '*',
+	[0x41] = '<', [0x42] = 'K', [0x43] = 'I', [0x44] = 'O', [0x45] = ')', [0x46] = '(', [0x49] = '>', [0x4A] = '?',
+	[0x4B] = 'L', [0x4C] = ':', [0x4D] = 'P', [0x4E] = '_', [0x52] = '"', [0x54] = '{', [0x55] = '+', [0x5A] = '\n',
+	[0x5B] = '}', [0x5D] = '|', [0x66] = PS2_KEY_BACKSPACE, [0x76] = PS2_KEY_ESCAPE,
+};
+
+/*
+ * Set up TIM16 to capture the keyboard's clock on PB8, counting microseconds so the gaps between frames can be seen
+ */
+void ps2Init() {
+	RCC->AHBENR |= RCC_AHBENR_GPIOBEN;
+	RCC->APB2ENR |= RCC_APB2ENR_TIM16EN;
+
+	GPIOB->MODER |= 0x2 << (2 * 8); // B8 alternate function, B9 stays an input
+	GPIOB->AFR[1] |= 0x2 << (4 * 0); // AF2 == TIM16_CH1
+
+	TIM16->PSC = 40 - 1; // 1 MHz
+	TIM16->ARR = 0xFFFF;
+	// capture TI1, only after 6 samples in a row at fDTS / 4 (0.6 us) agree, so ringing on a long cable isn't an edge
+	TIM16->CCMR1 = TIM_CCMR1_CC1S_0 | (0x6 << 4);
+	TIM16->CCER = TIM_CCER_CC1E | TIM_CCER_CC1P; // on the falling edge, when the keyboard has the data bit out
+	TIM16->DIER = TIM_DIER_CC1IE;
+
+	NVIC->ISER[0] |= 1 << TIM16_IRQn;
+	NVIC_SetPriority(TIM16_IRQn, 3); // lowest priority, it must never hold off the line interrupt
+	TIM16->CR1 = TIM_CR1_CEN;
+}
+
+/*
+ * A falling edge of the clock: shift the data bit in, and queue the scancode when the frame is complete
+ * The frame is a start bit (0), 8 data bits LSB first, an odd parity bit and a stop bit (1)
+ * Runs from RAM, so a key pressed while the flash writer erases a page doesn't stall the bus (see flashwriter.c)
+ */
+RAMFUNC void TIM16_IRQHandler() {
+	int bit = (GPIOB->IDR >> 9) & 1;
+	uint16_t at = TIM16->CCR1; // reading it clears the flag
+
+	if((uint16_t) (at - ps2LastEdge) > PS2_GAP_US) {
+		ps2Frame = 0;
+		ps2BitCount = 0;
+	}
+	ps2LastEdge = at;
+	ps2Frame |= bit << ps2BitCount;
+	if(++ps2BitCount < 11)
+		return;
+
+	// the data and parity bits have to have an odd number of ones between them
+	uint32_t parity = (ps2Frame >> 1) & 0x1ff;
+	parity ^= parity >> 8;
+	parity ^= parity >> 4;
+	parity ^= parity >> 2;
+	parity ^= parity >> 1;
+	uint8_t next = (codeHead + 1) & (CODE_SIZE - 1);
+	if((ps2Frame & 0x1) || !(ps2Frame & 0x400) || !(parity & 1) || next == codeTail) {
+		ps2Errors++;
+	} else {
+		codes[codeHead] = ps2Frame >> 1;
+		codeHead = next;
+	}
+	ps2Frame = 0;
+	ps2BitCount = 0;
+}
+
+/*
+ * Decode the scancodes that have come in since the last call into characters for ps2ReadKey
+ * Keys are pressed with their code and released with 0xF0 and their code, and some have an 0xE0 in front. Only the
+ * shift keys need to be followed while they're held. Caps lock is followed too, but its light stays off: setting it
+ * needs a command sent to the keyboard
+ */
+void ps2Update() {
+	static uint8_t released = 0, extended = 0, shift = 0, caps = 0;
+
+	while(codeTail != codeHead) {
+		uint8_t code = codes[codeTail];
+		codeTail = (codeTail + 1) & (CODE_SIZE - 1);
+
+		if(code == 0xE0) {
+			extended = 1;
+			continue;
+		}
+		if(code == 0xF0) {
+			released = 1;
+			continue;
+		}
+		if(!extended && (code == 0x12 || code == 0x59)) {
+			shift = !released;
+		} else if(!released && !extended && code == 0x58) {
+			caps = !caps;
+		} else if(!released && code < 0x80 && (!extended || code == 0x5A || code == 0x4A)) { // keypad enter and /
+			char c = (shift ? shifted : unshifted)[code];
+			if(caps && ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')))
+				c ^= 0x20;
+			uint8_t next = (keyHead + 1) & (KEY_SIZE - 1);
+			if(c && next != keyTail) {
+				keys[keyHead] = c;
+				keyHead = next;
+			}
+		}
+		released = 0;
+		extended = 0;
+	}
+}
+
+/*
+ * returns the next typed character, or -1 if there isn't one
+ */
+int ps2ReadKey() {
+	if(keyTail == keyHead)
+		return -1;
+	int c = keys[keyTail];
+	keyTail = (keyTail + 1) & (KEY_SIZE - 1);
+	return c;
+}
@@ -0,0 +1,53 @@
+#include "stm32f0xx.h"
+#include "uart.h"
+#include "ram.h"
+
+// from LinkerScript.ld: the end of the static RAM (where the heap starts) and the top of the stack
+extern uint32_t end[];
+extern uint32_t _estack[];
+
+// the lowest word the stack can't have reached yet: everything from the heap to here is free
+static uint32_t *heapTop() {
+	return end + (heapUsed + 3) / 4;
+}
+
+/*
+ * Fill the free RAM between the heap and the stack with the pattern, leaving this function's own frame alone
+ * Painting 2-3K takes about 70 us, so it's done after the sync has started
+ */
+void ramPaintStack() {
+	uint32_t *sp = (uint32_t *) __get_MSP() - 8;
+	for(uint32_t *p = heapTop(); p < sp; p++)
+		*p = RAM_PAINT;
+}
+
+/*
+ * bytes of stack the deepest call chain (with interrupts) has used since the paint
+ */
+uint32_t ramStackUsed() {
+	uint32_t *p = heapTop();
+	while(p < _estack && *p == RAM_PAINT)
+		p++;
+	return (uint32_t) (_estack - p) * 4;
+}
+
+/*
+ * bytes between the heap and the deepest the stack has been, which nothing has touched yet
+ */
+uint32_t ramHeadroom() {
+	return (uint32_t) (_estack - heapTop()) * 4 - ramStackUsed();
+}
+
+void ramReport() {
+	uartPrint("ram: stack ");
+	uartPrintNum(ramStackUsed());
+	uartPrint(" bytes at most, heap ");
+	uartPrintNum(heapUsed);
+	uartPrint(" (peak ");
+	uartPrintNum(heapPeak);
+	uartPrint(", ");
+	uartPrintNum(heapFailed);
+	uartPrint(" refused), ");
+	uartPrintNum(ramHeadroom());
+	uartPrint(" never touched\n");
+}
@@ -0,0 +1,44 @@
+/*
+ * Stand-in peripherals for building the video core on a PC (see regs.h). Empty on the target.
+ */
+#ifdef HOST
+
+#include <string.h>
+#include "regs.h"
+
+GPIO_TypeDef hostGPIOA, hostGPIOB, hostGPIOC;
+TIM_TypeDef hostTIM2, hostTIM3, hostTIM15;
+DMA_Channel_TypeDef hostDMA1_Channel5;
+SPI_TypeDef hostSPI1;
+
+regWrite regLog[REG_LOG_SIZE];
+int regLogCount = 0;
+uint32_t irqEnabled = 0;
+uint8_t irqPriority[32];
+
+void regRecord(const volatile void *reg, uint32_t value) {
+	if(regLogCount < REG_LOG_SIZE) {
+		regLog[regLogCount].reg = reg;
+		regLog[regLogCount].value = value;
+		regLogCount++;
+	}
+}
+
+/*
+ * clear the peripherals and the log, as if the chip had just come out of reset
+ */
+void regReset() {
+	memset(&hostGPIOA, 0, sizeof(hostGPIOA));
+	memset(&hostGPIOB, 0, sizeof(hostGPIOB));
+	memset(&hostGPIOC, 0, sizeof(hostGPIOC));
+	memset(&hostTIM2, 0, sizeof(hostTIM2));
+	memset(&hostTIM3, 0, sizeof(hostTIM3));
+	memset(&hostTIM15, 0, sizeof(hostTIM15));
+	memset(&hostDMA1_Channel5, 0, sizeof(hostDMA1_Channel5));
+	memset(&hostSPI1, 0, sizeof(hostSPI1));
+	regLogCount = 0;
+	irqEnabled = 0;
+	memset(irqPriority, 0, sizeof(irqPriority));
+}
+
+#endif
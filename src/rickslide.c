@@ -1,62 +0,0 @@
-const char rickslide[4800] = {
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 63, 63, 63, 63, 63, 63, 63, 33, 33, 33, 33, 33, 63, 63, 63, 63, 63, 33, 33, 33, 33, 59, 63, 63, 63, 63, 63, 63, 63, 63, 33, 33, 33, 33, 33, 33, 33, 59, 63, 63, 63, 54, 33, 33, 33, 33, 54, 63, 63, 63, 59, 33, 33, 33, 33, 63, 63, 63, 63, 58, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 58, 63, 58, 33, 33, 33, 63, 63, 37, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 58, 63, 33, 33, 58, 63, 54, 33, 33, 58, 63, 54, 33, 37, 63, 59, 33, 33, 63, 63, 33, 33, 54, 63, 58, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 37, 63, 58, 33, 33, 33, 33, 33, 63, 63, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 63, 58, 33, 33, 33, 63, 59, 33, 33, 63, 58, 33, 33, 33, 58, 63, 33, 54, 63, 54, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 54, 54, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 63, 59, 33, 54, 63, 37, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 58, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 63, 59, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 58, 63, 37, 33, 58, 63, 33, 63, 63, 63, 58, 33, 33, 33, 33, 33, 33, 33, 33, 63, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 63, 63, 63, 63, 63, 63, 58, 33, 33, 63, 58, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 63, 63, 63, 63, 63, 63, 58, 33, 33, 33, 33, 33, 33, 33, 33, 58, 63, 63, 58, 33, 33, 58, 63, 63, 33, 33, 37, 63, 59, 33, 33, 33, 33, 33, 33, 54, 63, 58, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 63, 58, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 63, 63, 33, 58, 63, 54, 33, 33, 33, 58, 63, 37, 33, 33, 33, 33, 37, 63, 59, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 63, 59, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 54, 63, 37, 58, 63, 33, 33, 33, 33, 54, 63, 54, 33, 33, 33, 37, 63, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 58, 63, 33, 33, 33, 33, 33, 33, 54, 63, 54, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 37, 63, 54, 54, 63, 33, 33, 33, 33, 54, 63, 54, 33, 33, 37, 63, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 37, 63, 58, 33, 33, 33, 33, 33, 63, 63, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 37, 63, 58, 33, 33, 33, 58, 63, 37, 33, 63, 58, 33, 33, 33, 58, 63, 33, 33, 54, 63, 59, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 58, 63, 58, 33, 33, 33, 63, 63, 37, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 63, 63, 33, 33, 37, 63, 58, 33, 33, 58, 63, 37, 33, 54, 63, 58, 33, 33, 63, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 59, 63, 63, 63, 63, 63, 63, 63, 63, 37, 33, 33, 33, 33, 63, 63, 63, 63, 63, 33, 33, 33, 33, 59, 63, 63, 63, 63, 63, 63, 63, 63, 37, 33, 33, 33, 33, 33, 33, 59, 63, 63, 63, 58, 33, 33, 33, 33, 58, 63, 63, 63, 58, 33, 33, 58, 63, 63, 63, 63, 63, 63, 63, 37, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 18, 18, 18, 18, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18, 18, 18, 18, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 18, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 3, 3, 3, 3, 3, 18, 18, 18, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 18, 18, 18, 3, 3, 3, 3, 3, 3, 3, 18, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 3, 3, 3, 18, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 18, 3, 3, 3, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 3, 3, 18, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 18, 3, 3, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 3, 18, 33, 33, 33, 33, 18, 3, 3, 3, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 18, 3, 3, 33, 33, 33, 33, 59, 63, 63, 63, 63, 63, 63, 58, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 18, 3, 3, 3, 33, 33, 33, 33, 33, 33, 33, 33, 33, 37, 63, 54, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 18, 33, 33, 33, 33, 
-33, 33, 33, 33, 3, 3, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 37, 63, 59, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 37, 63, 54, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 33, 33, 33, 33, 
-33, 33, 33, 3, 3, 18, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 54, 63, 54, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 33, 37, 63, 54, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 33, 33, 33, 
-33, 33, 33, 3, 3, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 63, 59, 33, 33, 59, 63, 33, 33, 54, 63, 63, 63, 63, 33, 33, 18, 3, 3, 3, 43, 63, 59, 33, 33, 37, 63, 54, 33, 33, 59, 63, 63, 63, 63, 33, 33, 59, 63, 33, 33, 33, 59, 63, 33, 54, 63, 63, 63, 63, 33, 33, 33, 33, 33, 33, 33, 3, 3, 33, 33, 33, 
-33, 33, 18, 3, 18, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 59, 63, 33, 37, 63, 58, 33, 33, 63, 63, 33, 33, 63, 23, 3, 3, 18, 63, 59, 33, 37, 63, 54, 33, 59, 63, 33, 33, 33, 63, 63, 33, 54, 63, 37, 33, 33, 63, 58, 37, 63, 58, 33, 33, 63, 63, 33, 33, 33, 33, 33, 33, 18, 3, 18, 33, 33, 
-33, 33, 3, 3, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 58, 63, 33, 33, 59, 63, 33, 54, 63, 37, 33, 33, 33, 37, 33, 33, 63, 59, 18, 3, 3, 19, 63, 33, 37, 63, 54, 33, 63, 58, 33, 33, 33, 59, 63, 33, 33, 63, 58, 33, 54, 63, 37, 54, 63, 37, 33, 33, 33, 37, 33, 33, 33, 33, 33, 33, 33, 3, 3, 33, 33, 
-33, 33, 3, 3, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 58, 63, 33, 33, 59, 63, 33, 33, 63, 63, 58, 33, 33, 33, 33, 33, 63, 58, 33, 33, 3, 3, 3, 38, 37, 63, 54, 33, 33, 33, 33, 63, 63, 63, 63, 33, 33, 59, 63, 33, 58, 63, 33, 33, 63, 63, 58, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 33, 33, 
-33, 33, 3, 3, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 59, 63, 33, 33, 33, 63, 63, 63, 63, 58, 33, 33, 63, 58, 33, 33, 33, 19, 3, 3, 18, 63, 54, 33, 59, 63, 63, 63, 33, 59, 63, 33, 33, 58, 63, 33, 63, 58, 33, 33, 33, 63, 63, 63, 63, 58, 33, 33, 33, 33, 33, 33, 33, 3, 3, 33, 33, 
-33, 33, 3, 3, 33, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 63, 59, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 63, 63, 54, 33, 63, 58, 33, 33, 33, 37, 23, 3, 3, 23, 38, 54, 63, 54, 33, 33, 33, 59, 63, 33, 33, 37, 63, 58, 63, 54, 33, 33, 33, 33, 33, 33, 63, 63, 54, 33, 33, 33, 33, 33, 33, 3, 3, 33, 33, 
-33, 33, 18, 3, 18, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 33, 54, 63, 54, 33, 33, 59, 63, 33, 33, 33, 33, 33, 33, 37, 63, 58, 33, 63, 59, 33, 33, 33, 58, 63, 33, 3, 3, 3, 38, 63, 37, 33, 33, 33, 63, 63, 33, 33, 33, 63, 63, 63, 33, 33, 33, 33, 33, 33, 33, 37, 63, 58, 33, 33, 33, 33, 33, 18, 3, 18, 33, 33, 
-33, 33, 18, 3, 3, 33, 33, 33, 33, 33, 33, 59, 63, 33, 33, 33, 33, 54, 63, 58, 33, 33, 33, 59, 63, 33, 58, 63, 54, 33, 33, 58, 63, 37, 33, 63, 63, 54, 33, 37, 63, 58, 33, 37, 23, 3, 3, 23, 58, 33, 33, 59, 63, 63, 33, 33, 33, 58, 63, 59, 33, 33, 58, 63, 54, 33, 33, 58, 63, 37, 33, 33, 33, 33, 33, 3, 3, 18, 33, 33, 
-33, 33, 33, 3, 3, 18, 33, 33, 33, 33, 33, 59, 63, 63, 63, 63, 63, 63, 54, 33, 33, 33, 33, 59, 63, 33, 33, 58, 63, 63, 63, 63, 37, 33, 33, 63, 58, 63, 63, 63, 58, 33, 33, 37, 63, 22, 3, 3, 23, 63, 63, 59, 58, 63, 54, 33, 33, 37, 63, 58, 33, 33, 33, 58, 63, 63, 63, 63, 37, 33, 33, 33, 33, 33, 18, 3, 3, 33, 33, 33, 
-33, 33, 33, 33, 3, 3, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 63, 58, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 54, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 33, 33, 33, 33, 
-33, 33, 33, 33, 18, 3, 3, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 63, 58, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 59, 59, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 18, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 63, 58, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 33, 33, 37, 63, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 18, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 3, 3, 3, 18, 33, 33, 33, 33, 33, 18, 18, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 18, 33, 33, 18, 3, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 3, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 3, 3, 3, 18, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 18, 3, 3, 3, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 3, 3, 3, 3, 3, 3, 3, 3, 18, 18, 18, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 18, 18, 18, 3, 3, 3, 3, 3, 3, 3, 3, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 63, 63, 33, 33, 63, 33, 33, 33, 33, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 18, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 63, 33, 33, 63, 33, 63, 33, 33, 33, 33, 63, 33, 63, 33, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 18, 18, 18, 18, 18, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 18, 18, 18, 18, 18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 63, 33, 63, 33, 63, 63, 33, 33, 63, 33, 63, 33, 33, 63, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 63, 33, 33, 63, 33, 63, 33, 63, 33, 33, 63, 33, 63, 33, 63, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 
-33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33
-};
@@ -0,0 +1,126 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "uart.h"
+#include "sched.h"
+
+#define FRAME_CYCLES (FRAME_LINES * LINE_CYCLES)
+
+static schedTask *tasks = 0;
+static int taskCount = 0;
+static unsigned int countedFrame = 0; // the frame the tasks' cycles are being counted for
+static uint32_t deadline = VISIBLE_END; // TIM2 count the running task has to be done by
+
+/*
+ * cycles from one TIM2 count until the next time it reaches another, going forwards round the frame
+ */
+static uint32_t cyclesUntil(uint32_t from, uint32_t to) {
+	return to >= from ? to - from : FRAME_CYCLES - from + to;
+}
+
+/*
+ * Whether the task can start now without tearing or holding up the frame update, and if so set the deadline
+ */
+static int fits(const schedTask *task, uint32_t now) {
+	uint32_t left = cyclesUntil(now, VISIBLE_END);
+	uint32_t until = VISIBLE_END;
+	if(task->bottom) {
+		// the band's first pixel is a little way into its first line, and its last one is done by the end of the line
+		uint32_t start = VISIBLE_START + task->top * LINE_CYCLES + PIXEL_START;
+		uint32_t end = VISIBLE_START + task->bottom * LINE_CYCLES;
+		if(cyclesUntil(start, now) < end - start) // the beam is in the band
+			return 0;
+		if(cyclesUntil(now, start) < left) {
+			left = cyclesUntil(now, start);
+			until = start;
+		}
+	}
+	if(task->cost > left)
+		return 0;
+	deadline = until;
+	return 1;
+}
+
+/*
+ * Start scheduling a table of tasks, all due straight away
+ */
+void schedInit(schedTask *table, int count) {
+	for(int i = 0; i < count; i++) {
+		table[i].lastFrame = frameCount - table[i].period;
+		table[i].cycles = 0;
+		table[i].lastCycles = 0;
+		table[i].maxRun = 0;
+		table[i].runs = 0;
+		table[i].late = 0;
+	}
+	countedFrame = frameCount;
+	tasks = table;
+	taskCount = count;
+}
+
+/*
+ * Run the tasks that are due and fit where the beam is, in table order
+ * Call it every time the main loop wakes up, after the frame update
+ */
+void schedRun() {
+	if(lendflag) // the frame update hasn't been done yet
+		return;
+
+	unsigned int now = frameCount;
+	if(now != countedFrame) {
+		for(int i = 0; i < taskCount; i++) {
+			tasks[i].lastCycles = tasks[i].cycles;
+			tasks[i].cycles = 0;
+		}
+		countedFrame = now;
+	}
+
+	for(int i = 0; i < taskCount; i++) {
+		schedTask *task = &tasks[i];
+		if(task->period && now - task->lastFrame < task->period)
+			continue;
+		uint32_t start = TIM2->CNT;
+		if(!fits(task, start))
+			continue;
+
+		task->run();
+
+		uint32_t end = TIM2->CNT;
+		uint32_t taken = cyclesUntil(start, end);
+		if(taken > cyclesUntil(start, deadline))
+			task->late++;
+		if(taken > task->maxRun)
+			task->maxRun = taken;
+		task->cycles += taken;
+		task->runs++;
+		task->lastFrame = now;
+	}
+}
+
+/*
+ * For a task to check while it runs: how many cycles it has left before its deadline
+ * 0 once it's past it (or nearly a frame if it's badly overrun, so don't keep asking for long after that)
+ */
+uint32_t schedCyclesLeft() {
+	uint32_t now = TIM2->CNT;
+	uint32_t left = cyclesUntil(now, deadline);
+	return left > FRAME_CYCLES - LINE_CYCLES ? 0 : left;
+}
+
+/*
+ * print a line per task over the UART: name, runs, cycles in the last frame, longest run and late runs
+ * this blocks for a few ms
+ */
+void schedReport() {
+	for(int i = 0; i < taskCount; i++) {
+		uartPrint(tasks[i].name);
+		uartWrite(' ');
+		uartPrintNum(tasks[i].runs);
+		uartWrite(' ');
+		uartPrintNum(tasks[i].lastCycles);
+		uartWrite(' ');
+		uartPrintNum(tasks[i].maxRun);
+		uartWrite(' ');
+		uartPrintNum(tasks[i].late);
+		uartWrite('\n');
+	}
+}
@@ -0,0 +1,128 @@
+#include <string.h>
+#include "uart.h"
+#include "shell.h"
+
+static const shellCommand *commands = 0;
+static int commandCount = 0;
+
+// the line being typed, or waiting for shellRun once it's complete
+static char line[SHELL_LINE + 1];
+static int lineLen = 0;
+static char lineReady = 0;
+static char tooLong = 0;
+
+// help's own line, listed before the commands
+static const char helpHelp[] = "help             this list";
+static int helpNext = -1; // the line of the list to send next, 0 for helpHelp then the commands, -1 if not listing
+
+void shellInit(const shellCommand *table, int count) {
+	commands = table;
+	commandCount = count;
+}
+
+/*
+ * Add a received byte to the line. Anything typed while a complete line is waiting to be run is dropped,
+ * so wait for the reply before sending the next one
+ */
+void shellInput(char c) {
+	if(lineReady)
+		return;
+	if(c == '\r' || c == '\n') {
+		if(lineLen || tooLong) // ignore blank lines, and the LF of a CR LF
+			lineReady = 1;
+	} else if(c == 0x08 || c == 0x7f) { // backspace or delete
+		if(lineLen)
+			lineLen--;
+	} else if(c >= ' ' && c <= '~') {
+		if(lineLen < SHELL_LINE)
+			line[lineLen++] = c;
+		else
+			tooLong = 1;
+	}
+}
+
+static const char *skipSpaces(const char *s) {
+	while(*s == ' ')
+		s++;
+	return s;
+}
+
+/*
+ * Parse a decimal number off the front of the arguments and move past it. Returns 0 if there isn't one
+ */
+int shellNumber(const char **args, uint32_t *n) {
+	const char *s = *args;
+	if(*s < '0' || *s > '9')
+		return 0;
+	*n = 0;
+	while(*s >= '0' && *s <= '9')
+		*n = *n * 10 + (*s++ - '0');
+	*args = skipSpaces(s);
+	return 1;
+}
+
+/*
+ * If the arguments start with the word, move past it and return 1
+ */
+int shellWord(const char **args, const char *word) {
+	const char *s = *args;
+	while(*word && *s == *word) {
+		s++;
+		word++;
+	}
+	if(*word || (*s && *s != ' '))
+		return 0;
+	*args = skipSpaces(s);
+	return 1;
+}
+
+/*
+ * Send as much of the command list as the UART's ring has room for, and carry on from there next time
+ */
+static void help() {
+	while(helpNext <= commandCount) {
+		const char *text = helpNext ? commands[helpNext - 1].help : helpHelp;
+		if(uartRoom() <= (int) strlen(text))
+			return;
+		uartPrint(text);
+		uartWrite('\n');
+		helpNext++;
+	}
+	helpNext = -1;
+}
+
+/*
+ * Run the line if there's a complete one and the last reply has gone out. Call it from the main loop: it's cheap
+ * when there's nothing to do, and never waits for the UART (see SHELL_REPLY)
+ */
+void shellRun() {
+	if(helpNext >= 0) {
+		help();
+		return;
+	}
+	if(!lineReady || uartRoom() < SHELL_REPLY)
+		return;
+	line[lineLen] = 0;
+	const char *args = skipSpaces(line);
+
+	if(tooLong) {
+		uartPrint("? line too long\n");
+	} else if(shellWord(&args, "help")) {
+		helpNext = 0;
+		help();
+	} else {
+		int i;
+		for(i = 0; i < commandCount; i++) {
+			if(shellWord(&args, commands[i].name)) {
+				commands[i].run(args);
+				break;
+			}
+		}
+		if(i == commandCount)
+			uartPrint("? unknown command, try help\n");
+	}
+
+	lineLen = 0;
+	tooLong = 0;
+	lineReady = 0;
+}
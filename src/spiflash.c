@@ -0,0 +1,125 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "spiflash.h"
+
+#define CS_PIN (1 << 12)
+
+static volatile char busy = 0;
+
+static void select() {
+	GPIOB->BRR = CS_PIN;
+}
+
+static void deselect() {
+	GPIOB->BSRR = CS_PIN;
+}
+
+/*
+ * send a byte and return the one that came in while it went out
+ */
+static uint8_t exchange(uint8_t out) {
+	*(volatile uint8_t *) &(SPI2->DR) = out; // a byte access, or it sends two
+	while(!(SPI2->SR & SPI_SR_RXNE));
+	return *(volatile uint8_t *) &(SPI2->DR);
+}
+
+static void sendCommand(uint8_t cmd, uint32_t addr) {
+	select();
+	exchange(cmd);
+	exchange(addr >> 16);
+	exchange(addr >> 8);
+	exchange(addr);
+}
+
+/*
+ * Set up SPI2 and DMA channel 4, wake the part up, and return its JEDEC ID (manufacturer, type and capacity bytes),
+ * 0 or 0xFFFFFF if nothing answered
+ */
+uint32_t spiFlashInit() {
+	RCC->AHBENR |= RCC_AHBENR_GPIOBEN | RCC_AHBENR_DMA1EN;
+	RCC->APB1ENR |= RCC_APB1ENR_SPI2EN;
+
+	deselect();
+	GPIOB->MODER |= (0x1 << (2 * 12)) | (0x2 << (2 * 13)) | (0x2 << (2 * 14)) | (0x2 << (2 * 15)); // AF0 == SPI2
+	GPIOB->OSPEEDR |= (0x3 << (2 * 12)) | (0x3 << (2 * 13)) | (0x3 << (2 * 15));
+
+	// master at PCLK / 2 (20 MHz), mode 0, software CS. RXNE on every byte
+	SPI2->CR1 = SPI_CR1_SSM | SPI_CR1_SSI | SPI_CR1_MSTR;
+	SPI2->CR2 = SPI_CR2_DS_2 | SPI_CR2_DS_1 | SPI_CR2_DS_0 | SPI_CR2_FRXTH;
+	SPI2->CR1 |= SPI_CR1_SPE;
+
+	// channel 4 takes SPI2_RX: bytes from the data register into memory, at the lowest priority
+	DMA1_Channel4->CCR = DMA_CCR_MINC | DMA_CCR_TCIE;
+	DMA1_Channel4->CPAR = (uint32_t) &(SPI2->DR);
+	NVIC->ISER[0] |= 1 << DMA1_Channel4_5_IRQn;
+	NVIC_SetPriority(DMA1_Channel4_5_IRQn, 3); // lowest priority, it must never hold off the line interrupt
+
+	// a part that was left in deep power-down ignores everything else
+	select();
+	exchange(SPIFLASH_CMD_RELEASE);
+	deselect();
+	for(volatile int i = 0; i < 200; i++); // it takes up to 30 us to wake
+
+	select();
+	exchange(SPIFLASH_CMD_JEDEC_ID);
+	uint32_t id = exchange(0) << 16;
+	id |= exchange(0) << 8;
+	id |= exchange(0);
+	deselect();
+	return id;
+}
+
+/*
+ * Read into buf and wait for it. Don't call it while a DMA read is going
+ */
+void spiFlashRead(uint32_t addr, void *buf, uint32_t len) {
+	uint8_t *p = buf;
+	sendCommand(SPIFLASH_CMD_READ, addr);
+	while(len--)
+		*p++ = exchange(0);
+	deselect();
+}
+
+/*
+ * Start reading into buf by DMA, returning 0 if a read is already going. spiFlashBusy says when it's done
+ */
+int spiFlashStart(uint32_t addr, void *buf, uint16_t len) {
+	if(busy || !len)
+		return 0;
+	busy = 1;
+	sendCommand(SPIFLASH_CMD_READ, addr);
+
+	// receive only: the clock runs from SPE being set until it's cleared, with a DMA request for every byte
+	while(SPI2->SR & SPI_SR_BSY);
+	SPI2->CR1 &= ~SPI_CR1_SPE;
+	SPI2->CR1 |= SPI_CR1_RXONLY;
+	SPI2->CR2 |= SPI_CR2_RXDMAEN;
+	DMA1_Channel4->CMAR = (uint32_t) buf;
+	DMA1_Channel4->CNDTR = len;
+	DMA1_Channel4->CCR |= DMA_CCR_EN;
+	SPI2->CR1 |= SPI_CR1_SPE;
+	return 1;
+}
+
+int spiFlashBusy() {
+	return busy;
+}
+
+/*
+ * The DMA has all the bytes: stop the clock, drop whatever came in after them, and end the command
+ * Runs from RAM so a read can finish while the internal flash is being written
+ */
+RAMFUNC void DMA1_Channel4_5_IRQHandler() {
+	if(!(DMA1->ISR & DMA_ISR_TCIF4))
+		return;
+	DMA1->IFCR = DMA_IFCR_CTCIF4;
+	SPI2->CR1 &= ~SPI_CR1_SPE; // the byte being clocked in finishes first
+	while(SPI2->SR & SPI_SR_BSY);
+	GPIOB->BSRR = CS_PIN; // not deselect(), which is in flash
+	DMA1_Channel4->CCR &= ~DMA_CCR_EN;
+	SPI2->CR2 &= ~SPI_CR2_RXDMAEN;
+	while(SPI2->SR & SPI_SR_FRLVL)
+		(void) *(volatile uint8_t *) &(SPI2->DR);
+	SPI2->CR1 = (SPI2->CR1 & ~SPI_CR1_RXONLY) | SPI_CR1_SPE;
+	busy = 0;
+}
@@ -0,0 +1,153 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "spiflash.h"
+#include "stream.h"
+
+#define ROW_BYTES (WIDTH + 1)
+// fewest rows worth starting a read for behind the beam, since each read costs a command and an interrupt
+#define MIN_ROWS 4
+
+uint32_t streamShown = 0;
+uint32_t streamLate = 0;
+uint32_t streamDropped = 0;
+
+static streamHeader header;
+static uint32_t base;
+static char opened = 0;
+
+static char looping;
+static char active = 0;
+static int current;           // the frame being read in, or the one on screen once it's been revealed
+static char pending = 0;      // the frame at current is still to be revealed
+static uint16_t duration;     // how many frames it's shown for
+static unsigned int due;      // the frame it's meant to be first shown in
+static unsigned int target;   // the frame it will be: due, or the next one if that's gone
+static int loadRow;           // rows of it asked for so far
+
+/*
+ * Look for a video at addr in the SPI flash. Returns how many frames it has, or 0 if there isn't one that can be shown
+ */
+uint32_t streamOpen(uint32_t addr) {
+	streamStop();
+	spiFlashRead(addr, &header, sizeof(header));
+	opened = header.magic == STREAM_MAGIC && header.format == STREAM_FORMAT_RAW && header.palette == PALETTE &&
+			header.frameSize == HEIGHT * ROW_BYTES && header.frames;
+	base = addr;
+	return opened ? header.frames : 0;
+}
+
+// polled, so only while no DMA read is going
+static uint16_t frameDuration(int i) {
+	uint16_t frames;
+	spiFlashRead(base + sizeof(header) + 2 * i, &frames, 2);
+	return frames ? frames : 1;
+}
+
+static uint32_t frameAddr(int i) {
+	return base + header.dataOffset + i * header.frameSize;
+}
+
+/*
+ * Move on to the next frame to read, skipping any whose time will be over before they could be shown
+ */
+static void next(unsigned int now) {
+	for(;;) {
+		if(current >= 0)
+			due += duration;
+		if(++current == (int) header.frames) {
+			if(!looping) { // the last frame stays up
+				current--;
+				return;
+			}
+			current = 0;
+		}
+		duration = frameDuration(current);
+		// the earliest it can be shown is the next frame
+		if((int) (due + duration - (now + 1)) > 0)
+			break;
+		streamDropped++;
+	}
+	target = (int) (due - (now + 1)) > 0 ? due : now + 1;
+	loadRow = 0;
+	pending = 1;
+}
+
+/*
+ * Start playing the video streamOpen found, with the video in colour mode. The first frame is due on the next frame
+ */
+int streamStart(int loop) {
+	streamStop();
+	if(!opened)
+		return 0;
+	looping = loop;
+	current = -1;
+	due = frameCount + 1;
+	active = 1;
+	next(frameCount);
+	return 1;
+}
+
+/*
+ * Stop playing, leaving the picture up
+ */
+void streamStop() {
+	active = 0;
+	pending = 0;
+	while(spiFlashBusy()); // it's writing into the screen buffer
+}
+
+int streamActive() {
+	return active;
+}
+
+/*
+ * Call every time the main loop wakes up. Starts reading the rows the beam has finished with (or all of them if the
+ * screen buffer isn't on screen) once the last read is done
+ */
+void streamLine() {
+	if(!pending || spiFlashBusy())
+		return;
+	int last;
+	if(frame != screen.color[0]) {
+		last = HEIGHT;
+	} else if(frameCount + 1 == target) {
+		last = rowsDone();
+		if(last - loadRow < MIN_ROWS)
+			return;
+	} else {
+		return;
+	}
+	if(last > loadRow) {
+		spiFlashStart(frameAddr(current) + loadRow * ROW_BYTES, screen.color[loadRow], (last - loadRow) * ROW_BYTES);
+		loadRow = last;
+	}
+}
+
+/*
+ * Call in the frame update: reads the last rows of the frame due on this frame and reveals it, then picks the next
+ */
+void streamUpdate() {
+	if(!active)
+		return;
+	unsigned int now = frameCount;
+	if(!pending || (int) (target - now) > 0)
+		return;
+	while(spiFlashBusy());
+	// if its time went by while it waited (the main loop was held up), skip to the one that's due now
+	if((int) (due + duration - now) <= 0) {
+		streamDropped++;
+		pending = 0;
+		next(now - 1);
+	}
+	if(pending && (int) (target - now) <= 0) {
+		// the rows at the bottom the beam has only just finished with, or all of them if it's late
+		if(spiFlashStart(frameAddr(current) + loadRow * ROW_BYTES, screen.color[loadRow], (HEIGHT - loadRow) * ROW_BYTES))
+			while(spiFlashBusy());
+		frame = screen.color[0];
+		pending = 0;
+		streamShown++;
+		if((int) (now - due) > 0 || !vblankCyclesLeft()) // a frame behind, or revealed part way down this one
+			streamLate++;
+		next(now);
+	}
+}
@@ -52,6 +52,8 @@
 #include <time.h>
 #include <sys/time.h>
 #include <sys/times.h>
+#include <stdint.h>
+#include "uart.h"
 
 
 /* Variables */
@@ -62,6 +64,11 @@ extern int __io_getchar(void) __attribute__((weak));
 
 register char * stack_ptr asm("sp");
 
+/* Heap counters for the RAM report, see inc/ram.h */
+uint32_t heapUsed = 0;
+uint32_t heapPeak = 0;
+uint32_t heapFailed = 0;
+
 char *__env[1] = { 0 };
 char **environ = __env;
 
@@ -100,14 +107,11 @@ int _read (int file, char *ptr, int len)
 return len;
 }
 
+/* stdout and stderr go to the UART's transmit ring and never wait on the line. Whatever doesn't fit is dropped
+ * (and counted in uartDropped) rather than reported, so newlib doesn't retry it */
 int _write(int file, char *ptr, int len)
 {
-	int DataIdx;
-
-	for (DataIdx = 0; DataIdx < len; DataIdx++)
-	{
-		__io_putchar(*ptr++);
-	}
+	uartSend(ptr, len);
 	return len;
 }
 
@@ -125,11 +129,15 @@ caddr_t _sbrk(int incr)
 	{
 //		write(1, "Heap and stack collision\n", 25);
 //		abort();
+		heapFailed++;
 		errno = ENOMEM;
 		return (caddr_t) -1;
 	}
 
 	heap_end += incr;
+	heapUsed = heap_end - &end;
+	if (heapUsed > heapPeak)
+		heapPeak = heapUsed;
 
 	return (caddr_t) prev_heap_end;
 }
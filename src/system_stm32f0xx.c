@@ -82,6 +82,7 @@
   */
 
 #include "stm32f0xx.h"
+#include "boot.h"
 
 /**
   * @}
@@ -120,7 +121,7 @@
 /** @addtogroup STM32F0xx_System_Private_Variables
   * @{
   */
-uint32_t SystemCoreClock    = 48000000;
+uint32_t SystemCoreClock    = 40000000;
 __I uint8_t AHBPrescTable[16] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 6, 7, 8, 9};
 
 /**
@@ -285,9 +286,9 @@ static void SetSysClock(void)
   /* PCLK = HCLK */
   RCC->CFGR |= (uint32_t)RCC_CFGR_PPRE_DIV1;
 
-  /* PLL configuration = (HSI/2) * 12 = ~48 MHz */
+  /* PLL configuration = (HSI/2) * 10 = ~40 MHz, the VGA pixel clock, so main doesn't have to lock it again */
   RCC->CFGR &= (uint32_t)((uint32_t)~(RCC_CFGR_PLLSRC | RCC_CFGR_PLLXTPRE | RCC_CFGR_PLLMULL));
-  RCC->CFGR |= (uint32_t)(RCC_CFGR_PLLSRC_HSI_Div2 | RCC_CFGR_PLLXTPRE_PREDIV1 | RCC_CFGR_PLLMULL12);
+  RCC->CFGR |= (uint32_t)(RCC_CFGR_PLLSRC_HSI_Div2 | RCC_CFGR_PLLXTPRE_PREDIV1 | RCC_CFGR_PLLMULL10);
             
   /* Enable PLL */
   RCC->CR |= RCC_CR_PLLON;
@@ -297,6 +298,9 @@ static void SetSysClock(void)
   {
   }
 
+  /* SysTick has been counting at the HSI since reset, and counts 5 times faster from here */
+  bootClockSwitch();
+
   /* Select PLL as system clock source */
   RCC->CFGR &= (uint32_t)((uint32_t)~(RCC_CFGR_SW));
   RCC->CFGR |= (uint32_t)RCC_CFGR_SW_PLL;    
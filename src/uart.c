@@ -0,0 +1,168 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "uart.h"
+
+// received bytes, filled by the interrupt and drained by the main loop
+#define RX_SIZE 64 // must be a power of two
+static volatile uint8_t rxBuf[RX_SIZE];
+static volatile uint8_t rxHead = 0;
+static volatile uint8_t rxTail = 0;
+
+// bytes to send, added by uartWrite and uartSend and sent by DMA channel 2 a contiguous run at a time
+#define TX_SIZE 256 // must be a power of two, and hold the shell's longest reply (see SHELL_REPLY)
+static uint8_t txBuf[TX_SIZE];
+static volatile uint8_t txHead = 0;
+static volatile uint8_t txTail = 0;
+static volatile uint8_t txSending = 0; // bytes in the run the DMA is sending
+static volatile uint8_t txWriting = 0; // set while bytes are being added, so an interrupt doesn't add its own between
+
+volatile uint32_t uartDropped = 0;
+
+void uartInit() {
+	RCC->AHBENR |= RCC_AHBENR_GPIOAEN;
+	RCC->APB2ENR |= RCC_APB2ENR_USART1EN;
+	RCC->AHBENR |= RCC_AHBENR_DMA1EN;
+
+	GPIOA->MODER |= (0x2 << (2 * 9)) | (0x2 << (2 * 10)); // A9 and A10 alternate function
+	GPIOA->AFR[1] |= (0x1 << (4 * 1)) | (0x1 << (4 * 2)); // AF1 == USART1_TX and USART1_RX
+
+	USART1->BRR = 40000000 / UART_BAUD;
+	USART1->CR3 = USART_CR3_DMAT;
+	USART1->CR1 = USART_CR1_RXNEIE | USART_CR1_RE | USART_CR1_TE | USART_CR1_UE;
+
+	// channel 2 is USART1_TX: memory to peripheral, a byte at a time, at the lowest priority so it never holds up
+	// the pixels. It's only enabled for a run at a time, by the interrupt
+	DMA1_Channel2->CCR = DMA_CCR_MINC | DMA_CCR_DIR | DMA_CCR_TCIE;
+	DMA1_Channel2->CPAR = (uint32_t) &(USART1->TDR);
+
+	NVIC->ISER[0] |= (1 << USART1_IRQn) | (1 << DMA1_Channel2_3_IRQn);
+	NVIC_SetPriority(USART1_IRQn, 3); // lowest priority, it must never hold off the line interrupt
+	NVIC_SetPriority(DMA1_Channel2_3_IRQn, 3);
+}
+
+/*
+ * Runs from RAM so bytes keep arriving while flash is being written
+ */
+RAMFUNC void USART1_IRQHandler() {
+	if(USART1->ISR & USART_ISR_ORE)
+		USART1->ICR = USART_ICR_ORECF; // a byte was lost, the protocol checksum will catch it
+	if(USART1->ISR & USART_ISR_RXNE) {
+		uint8_t c = USART1->RDR;
+		uint8_t next = (rxHead + 1) & (RX_SIZE - 1);
+		if(next != rxTail) { // drop the byte if the buffer is full
+			rxBuf[rxHead] = c;
+			rxHead = next;
+		}
+	}
+}
+
+/*
+ * A run of bytes has been sent, or a writer wants one started: send the next run from the ring, up to its end or
+ * the last byte added. This is the only place the DMA is started, so writers never race it for the channel
+ * Runs from RAM so replies still go out while flash is being written
+ */
+RAMFUNC void DMA1_Channel2_3_IRQHandler() {
+	if(DMA1->ISR & DMA_ISR_TCIF2) {
+		DMA1->IFCR = DMA_IFCR_CTCIF2;
+		txTail = (txTail + txSending) & (TX_SIZE - 1);
+		txSending = 0;
+	}
+	uint8_t head = txHead;
+	if(txSending || txTail == head)
+		return;
+	int run = (head > txTail ? head : TX_SIZE) - txTail;
+	DMA1_Channel2->CCR &= ~DMA_CCR_EN;
+	DMA1_Channel2->CMAR = (uint32_t) &txBuf[txTail];
+	DMA1_Channel2->CNDTR = run;
+	txSending = run;
+	DMA1_Channel2->CCR |= DMA_CCR_EN;
+}
+
+/*
+ * Add bytes to the ring and get the DMA going. With wait set it waits for room, otherwise it stops when the ring is
+ * full. Returns how many were added: none if it interrupted another write, since the bytes would get mixed up
+ * The ring has one writer at a time and one reader (the DMA interrupt), so it doesn't need interrupts turned off
+ */
+static int txQueue(const char *data, int len, int wait) {
+	if(txWriting)
+		return 0;
+	txWriting = 1; // an interrupt between the check and here finishes its write before this one starts
+	int i;
+	for(i = 0; i < len; i++) {
+		uint8_t next = (txHead + 1) & (TX_SIZE - 1);
+		if(next == txTail) {
+			if(!wait)
+				break;
+			NVIC_SetPendingIRQ(DMA1_Channel2_3_IRQn);
+			while(next == txTail);
+		}
+		txBuf[txHead] = data[i];
+		txHead = next;
+	}
+	txWriting = 0;
+	NVIC_SetPendingIRQ(DMA1_Channel2_3_IRQn);
+	return i;
+}
+
+/*
+ * how many bytes can be added to the ring without waiting
+ */
+int uartRoom() {
+	return (txTail - txHead - 1) & (TX_SIZE - 1);
+}
+
+/*
+ * returns the next received byte, or -1 if there isn't one
+ */
+int uartRead() {
+	if(rxTail == rxHead)
+		return -1;
+	int c = rxBuf[rxTail];
+	rxTail = (rxTail + 1) & (RX_SIZE - 1);
+	return c;
+}
+
+/*
+ * Send a byte, waiting for room in the ring if it's full. For the protocols' replies, which mustn't be lost
+ * It waits on the DMA interrupt, so it can only be called from the main loop
+ */
+void uartWrite(char c) {
+	if(!txQueue(&c, 1, 1))
+		uartDropped++;
+}
+
+/*
+ * Send bytes without waiting: whatever doesn't fit in the ring is dropped and counted in uartDropped
+ * Safe anywhere, including interrupts (which drop everything if they interrupt another write)
+ */
+int uartSend(const char *data, int len) {
+	int sent = txQueue(data, len, 0);
+	uartDropped += len - sent;
+	return sent;
+}
+
+void uartPrint(const char *s) {
+	while(*s)
+		uartWrite(*s++);
+}
+
+// printf would pull in far too much of newlib for 32K of flash
+void uartPrintNum(uint32_t n) {
+	char buf[10];
+	int i = 0;
+	do {
+		buf[i++] = '0' + n % 10;
+		n /= 10;
+	} while(n);
+	while(i)
+		uartWrite(buf[--i]);
+}
+
+void uartPrintInt(int32_t n) {
+	if(n < 0) {
+		uartWrite('-');
+		uartPrintNum(-(uint32_t) n);
+	} else {
+		uartPrintNum(n);
+	}
+}
@@ -0,0 +1,359 @@
+#include "regs.h"
+#include "vga.h"
+#include "genlock.h"
+
+// allocate screenbuffer. It isn't cleared at reset (see the .noinit section in LinkerScript.ld), so it holds
+// whatever was in RAM until an image is copied in, and frame doesn't point at it until then
+screenBuffer screen __attribute__((section(".noinit"), aligned(4))); // aligned for word fills
+
+// the rows the DMA scans out from. Usually this is the screen buffer, but any image laid out the same way
+// (including the zero edge pixel at the end of each row) can be shown directly from flash without a copy.
+// 0 until there's something to show, which keeps the DMA off and the picture black
+const char *volatile frame = 0;
+
+// temporal dithering: when both are set the vblank handler alternates between them every refresh,
+// so the monitor shows the average of the two frames
+const char *volatile ditherFrames[2];
+volatile unsigned int frameCount = 0;
+
+// the layout of the rows in the current video mode, see setVideoMode
+volatile uint8_t videoMode = VIDEO_COLOR;
+static int rowLines = 10; // scanlines each row is shown for
+static int rowCount = HEIGHT;
+static int rowStride = WIDTH + 1; // bytes from one row to the next
+static int fieldShift = 0; // 1 in field mode, where each buffer row is shared by two rows of the picture
+
+// flag for the interrupt that triggers when the screen in drawn
+char lendflag = 0;
+
+int curLine = HEIGHT; // start at the end of the buffer because the first line will trigger the interrupt, so it will tick over
+int lastChange = 0;
+
+// the fewest and most cycles from the line interrupt's compare to its first instruction, since they were last reset.
+// The spread is the jitter other interrupts and the bus add to it
+volatile uint16_t lineLatencyMin = 0xFFFF;
+volatile uint16_t lineLatencyMax = 0;
+
+/*
+ * Update the DMA request address after each line
+ * Runs from RAM so it keeps going while flash is busy (see flashwriter.c)
+ */
+RAMFUNC void TIM3_IRQHandler() {
+	REG_SET(GPIOC->ODR, 0x1);
+	uint16_t latency = TIM3->CNT - LINE_ISR_AT;
+	if(latency < lineLatencyMin)
+		lineLatencyMin = latency;
+	if(latency > lineLatencyMax)
+		lineLatencyMax = latency;
+	REG_CLEAR(TIM3->SR, TIM_SR_CC3IF);
+	if(genlockState != GENLOCK_OFF) {
+		// TIM3 is reset by the source's hsync every line but TIM2 only by its vsync, so put TIM2 back on the line
+		// TIM3 is on before anything looks at it. Reading the vsync capture clears its flag
+		if(TIM2->SR & TIM_SR_CC1IF) {
+			genlockCapture = TIM2->CCR1;
+			syncLine = 0;
+			syncVsyncs++;
+		} else if(++syncLine >= FRAME_LINES) {
+			syncLine = 0;
+		}
+		REG_WRITE(TIM2->CNT, syncLine * LINE_CYCLES + TIM3->CNT);
+	}
+	lastChange++;
+	if(lastChange >= rowLines) {
+		// If you don't disable the DMA request, it will immediately do a transfer when enabled
+		REG_WRITE(TIM15->DIER, 0);
+		REG_CLEAR(DMA1_Channel5->CCR, DMA_CCR_EN); // disable the DMA channel
+		// check if the next line (the one the DMA will scan out from this address) is in the visible region of the vertical sweep
+		// remember that TIM2 also counts at the pixel clock, so multiply the line numbers by 1056
+		if((TIM2->CNT > VISIBLE_START - LINE_CYCLES) && (TIM2->CNT < VISIBLE_END - LINE_CYCLES)) {
+			lastChange = 0;
+			curLine += 1;
+			if(curLine >= rowCount)
+				curLine = 0;
+
+			// in field mode only the even rows are shown in even frames and the odd rows in odd ones,
+			// the lines of the others are left black, as is everything until there is a frame to show
+			if(frame && ((curLine ^ frameCount) & fieldShift) == 0) {
+				REG_WRITE(DMA1_Channel5->CMAR, (uint32_t) (uintptr_t) (frame + (curLine >> fieldShift) * rowStride)); // change it to a new address
+				REG_SET(DMA1_Channel5->CCR, DMA_CCR_EN); // re-enable the DMA channel
+				REG_WRITE(TIM15->DIER, TIM_DIER_CC1DE);
+			}
+		}
+	}
+	REG_CLEAR(GPIOC->ODR, 0x1);
+}
+
+/*
+ * handler called immediately after the frame has finished drawing
+ * just sets a flag because we shouldn't spend a long time processing in an interrupt
+ * TODO: could do this as a DMA request, but that's less flexible
+ * this sets us up nicely for 'racing the beam'.
+ * You have a buffer of 29,568 clock cycles of buffer between this interrupt starting to be triggered and the first pixel being drawn
+ * then you have 10 clock cycles per pixel + 256 clock cycles at the end of each line (minus the TIM3 interrupt code)
+ * total, there are 663,168 clock cycles until this triggers again
+ * This is also where the dithered frames get swapped, since nothing is being scanned out right now
+ */
+RAMFUNC void TIM2_IRQHandler() {
+	REG_CLEAR(TIM2->SR, TIM_SR_CC3IF);
+	frameCount++;
+	if(ditherFrames[0] && ditherFrames[1])
+		frame = ditherFrames[frameCount & 1];
+	// start the next frame from the top row, even if the mode changed part way through this one
+	curLine = rowCount;
+	lastChange = rowLines;
+	lendflag = 1;
+}
+
+/*
+ * Setup Tim3 to output the hsync signal to A7
+ * Also Tim15 is the pixel clock, and outputs it to A2 for reference
+ * Tim15 does a DMA request to copy each pixel to GPIOB so it can drive the DAC
+ */
+void setupHorizontalTimers() {
+	/*
+	 * What we want to generate (in pixel clock units: 40 MHz):
+	 * |    800    |  40  |   128   |  88 |
+	 *                     _________
+	 * ___________________|         |______
+	 * |pixels here|
+	 *
+	 * If we rearrange a little (because it doesn't matter where the timer starts):
+	 * |   128   |  88 |    800    |  40  |
+	 *  _________
+	 * |         |_________________________
+	 *                 |pixels here|
+	 *
+	 * Note: It is important that the pixel lines are all LOW when we are outside of the pixel region
+	 * At least some monitors (like mine) use that as an important sync clue.
+	 * As such, we will use an extra pixel at the end of each sync line to reset the line to 0
+	 *
+	 * How we generate this: 2 timers
+	 *
+	 * Tim3 is the master timer:
+	 *     counts at 40 MHZ, the system clock
+	 *     CCx2 is the hsync pulse output:
+	 *         PWM mode one, outputs high until 128 pixel clocks then low until restart
+	 *     CCx1 is the pixel trigger:
+	 * 	       Mode doesn't really matter, its only here to send the master mode output at the compare value
+	 *     	   Set compare to 128+88=216.
+	 * 	       Set Master Mode Selection to Compare Pulse, so it sends a pulse at 216 pixel clocks
+	 * 	   CCx3 triggers an interrupt right after the pixels finish outputting
+	 * 	       This is primarily to keep the DMA address up to date, but might also be good for synchronizing screen updates
+	 *
+	 * Tim15 is the pixel timer:
+	 *     Fires an update event at the actual pixel output clock (so 4 MHz)
+	 *     Uses the Repeat counter to output the appropriate number of pixels (80)
+	 *     Triggers a DMA request channel 5 on every update event
+	 *     Slave mode triggered from Tim2
+	 *
+	 */
+
+	// first lets set up the master timer (TIM3)
+
+	REG_SET(GPIOA->MODER, (0x2 << (2 * 7))); // A7 alternate function
+	REG_SET(GPIOA->AFR[0], (0x1 << (4 * 7))); // AF1 == TIM3_CH2
+
+	// count the whole line (1056 long) at the system clock (40 MHz)
+	REG_WRITE(TIM3->PSC, 0);
+	REG_WRITE(TIM3->ARR, 1055);
+
+	// configure Capture/Compare channel 2
+	// bits 4:6 are mode
+	// 0x6 is PWM1 (high while count is below this value)
+	REG_SET(TIM3->CCMR1, ((0x6 << 4)) << 8);
+	REG_WRITE(TIM3->CCR2, 128);
+	REG_SET(TIM3->CCER, TIM_CCER_CC2E);
+
+	// configure CCx1, mode doesn't matter so leave it 0
+	// should be 216, but again it's kinda slow so add a fudge factor to make the timings work
+	REG_WRITE(TIM3->CCR1, PIXEL_START);
+	REG_SET(TIM3->CCER, TIM_CCER_CC1E);
+
+	// CR2_MMS = 0x3 is CC1IF flag set (pulse when CCx1 matches)
+	REG_SET(TIM3->CR2, 0x3 << 4);
+
+	// configure CCx3 for the end of the pixel output region
+	// should be 1016, but it takes several clock cycles for the interrupt to actually trigger, so use a fudge factor for more time before the next line starts
+	// again, mode doesn't matter
+	REG_WRITE(TIM3->CCR3, LINE_ISR_AT);
+	REG_SET(TIM3->CCER, TIM_CCER_CC3E);
+
+	REG_SET(TIM3->DIER, TIM_DIER_CC3IE); // enable the interrupt on CCx3 so that we can get the max number of cycles after the pixels are done
+	REG_IRQ_ENABLE(TIM3_IRQn, 0); // enable the interrupt for real, at the highest priority (0 is highest on the M0)
+
+	// now set up the pixel TIM15
+
+	// tim15 ccr1 outputs on PA2 with AF0 (just for making sure pixel clock is right)
+	REG_SET(GPIOA->MODER, 0x2 << (2 * 2));
+
+	REG_WRITE(TIM15->PSC, 0);
+	REG_WRITE(TIM15->ARR, 9); // should create 4MHz update events
+
+	// set the RCR to only send an update event after 81 timer resets (80 screen pixels + 1 edge pixel)
+	REG_WRITE(TIM15->RCR, 81 - 1);
+
+	REG_WRITE(TIM15->EGR, TIM_EGR_UG); // apparently you need to generate an update event to make this kick in
+
+	// use PWM mode 1 with CCR1 set to 1 to generate a pulse on every reset.
+	REG_SET(TIM15->CCMR1, 0x6 << 4);
+	REG_WRITE(TIM15->CCR1, 1);
+
+	REG_SET(TIM15->CCER, TIM_CCER_CC1E);
+
+	// set up DMA request generation from CCx1 since the update events are inhibited by the RCR
+	// triggers DMA channel 1
+	REG_SET(TIM15->DIER, TIM_DIER_CC1DE);
+
+	// set it to one pulse mode, but because RCR doesn't allow update for 80 overflows, it becomes 80 pulse mode
+	REG_SET(TIM15->CR1, TIM_CR1_OPM);
+
+	// enable the master outputs
+	REG_SET(TIM15->BDTR, TIM_BDTR_MOE);
+
+	// set up slave mode to be triggered from the output of TIM3
+	REG_SET(TIM15->SMCR, 0x1 << 4); // trigger select 1 is TIM3
+	REG_SET(TIM15->SMCR, 0x6); // slave mode select 6 is 'trigger mode' (start counter at rising edge)
+
+	// set up DMA channel 5:
+	// transfers one byte from memory to GPIOB->ODR, increment 80 times then circle
+	REG_SET(DMA1_Channel5->CCR,
+			DMA_CCR_PL |       // set it to the highest priority
+			DMA_CCR_MINC |     // increment memory address
+			DMA_CCR_CIRC |     // enable circular mode
+			DMA_CCR_DIR);      // transfer memory -> peripheral
+	REG_WRITE(DMA1_Channel5->CNDTR, 81); // transfer 81 elements before circling back
+	REG_WRITE(DMA1_Channel5->CPAR, (uint32_t) (uintptr_t) &(GPIOB->ODR));
+	REG_WRITE(DMA1_Channel5->CMAR, (uint32_t) (uintptr_t) frame);
+
+	// set up GPIOB to output on pins 0..7
+	for(int i = 0; i < 8; i++)
+		REG_SET(GPIOB->MODER, (0x1 << 2 * i));
+}
+
+/*
+ * Setup Tim2 to drive A1 to be the vsync signal
+ */
+void setupVerticalTimer() {
+	/*
+	 * TIM2 is the timer for the vsync signal. We're going to use the same trick as TIM2 to rearrange the signal
+	 * into something easily PWM1able.
+	 * |    4    |  23 |    600    |   1   | (in units of lines)
+	 *  _________
+	 * |         |__________________________
+	 *                 |pixels here|
+	 * The only difference is that the timer counts 1055 times slower (since it counts once per horizontal line)
+	 * TODO: I don't actually know what the timing between the hsync and vsync signal should be
+	 */
+
+	REG_SET(GPIOA->MODER, (0x2 << (2 * 1))); // A1 alternate function
+	REG_SET(GPIOA->AFR[0], (0x2 << (4 * 1))); // AF2 == TIM2_CH2
+
+	// count the whole line (628 long) at the horizontal line clock (1056x slower than the system clock)
+	// note that using the prescaler seems to enforce a phase between it and the system clock
+	// so we're using the infinite power of the 32 bit timer for this
+	REG_WRITE(TIM2->PSC, 0);
+	REG_WRITE(TIM2->ARR, (628 * 1056) - 1);
+
+	// configure Capture/Compare channel 2
+	// bits 4:6 are mode
+	// 0x6 is PWM1 (high while count is below this value)
+	REG_SET(TIM2->CCMR1, (0x6 << 4) << 8);
+	REG_WRITE(TIM2->CCR2, 4 * 1056);
+	REG_SET(TIM2->CCER, TIM_CCER_CC2E);
+
+	// add a screen refresh interrupt that triggers immediately after the visible region of the screen is drawn
+	REG_WRITE(TIM2->CCR3, 1056 * 627);
+	REG_SET(TIM2->CCER, TIM_CCER_CC3E);
+	REG_SET(TIM2->DIER, TIM_DIER_CC3IE);
+	REG_IRQ_ENABLE(TIM2_IRQn, 2); // at a low priority
+}
+
+/*
+ * Switch between the colour mode, the colour field mode and the bit-per-pixel mono mode
+ * Both are driven by the same chain: TIM3 starts TIM15 at the start of the pixels, and every TIM15 compare makes DMA
+ * channel 5 move a byte. In colour mode the byte goes to GPIOB every 10 cycles and is a pixel. In mono mode it goes to
+ * SPI1 every 16 cycles, which shifts it out of MOSI (PB5) at 20 MHz, so it's 8 pixels 2 cycles wide.
+ * SPI1 can't clock faster than PCLK / 2, so 400 pixels is as wide as the line gets.
+ * Field mode is the colour mode with 120 rows 5 lines tall, where even frames only show the even rows and odd frames
+ * the odd ones. Row 2k and 2k + 1 share row k of the buffer, which gets refilled once the beam is past it (see fieldSlotsDone)
+ * frame has to point at rows laid out for the new mode. Called in the vblank, the new mode starts from the first visible
+ * line. Called part way down the picture, the rest of that frame is left blank rather than torn, and it starts with the next.
+ */
+void setVideoMode(uint8_t mode) {
+	REG_WRITE(TIM15->DIER, 0);
+	REG_CLEAR(DMA1_Channel5->CCR, DMA_CCR_EN);
+
+	if(mode == VIDEO_MONO) {
+		// PB5 alternate function 0 is SPI1_MOSI
+		REG_CLEAR(GPIOB->MODER, 0x3 << (2 * 5));
+		REG_SET(GPIOB->MODER, 0x2 << (2 * 5));
+		REG_CLEAR(GPIOB->AFR[0], 0xf << (4 * 5));
+		REG_CLEAR(GPIOB->ODR, 0xff); // nothing writes the colour pins in this mode, so keep them black. PB12 is the NOR CS
+
+		// transmit only master (bidirectional mode, always output) with software slave select, at PCLK / 2
+		// 8 bit frames, msb (leftmost pixel) first. MOSI holds the last bit, which the zero edge byte makes black
+		REG_WRITE(SPI1->CR1, SPI_CR1_BIDIMODE | SPI_CR1_BIDIOE | SPI_CR1_SSM | SPI_CR1_SSI | SPI_CR1_MSTR);
+		REG_WRITE(SPI1->CR2, SPI_CR2_DS_2 | SPI_CR2_DS_1 | SPI_CR2_DS_0);
+		REG_SET(SPI1->CR1, SPI_CR1_SPE);
+
+		REG_WRITE(TIM15->ARR, 15); // a byte every 16 cycles, as fast as the SPI sends them
+		REG_WRITE(TIM15->RCR, MONO_STRIDE - 1);
+		REG_WRITE(DMA1_Channel5->CPAR, (uint32_t) (uintptr_t) &(SPI1->DR));
+		REG_WRITE(DMA1_Channel5->CNDTR, MONO_STRIDE);
+		rowLines = VISIBLE_LINES / MONO_HEIGHT;
+		rowCount = MONO_HEIGHT;
+		rowStride = MONO_STRIDE;
+		fieldShift = 0;
+	} else {
+		REG_CLEAR(SPI1->CR1, SPI_CR1_SPE);
+		REG_CLEAR(GPIOB->MODER, 0x3 << (2 * 5));
+		REG_SET(GPIOB->MODER, 0x1 << (2 * 5));
+
+		REG_WRITE(TIM15->ARR, 9);
+		REG_WRITE(TIM15->RCR, (WIDTH + 1) - 1);
+		REG_WRITE(DMA1_Channel5->CPAR, (uint32_t) (uintptr_t) &(GPIOB->ODR));
+		REG_WRITE(DMA1_Channel5->CNDTR, WIDTH + 1);
+		fieldShift = mode == VIDEO_FIELDS;
+		rowCount = HEIGHT << fieldShift;
+		rowLines = VISIBLE_LINES / rowCount;
+		rowStride = WIDTH + 1;
+	}
+	REG_WRITE(TIM15->EGR, TIM_EGR_UG); // load the new repetition count
+	curLine = rowCount;
+	// the line interrupt counts lastChange up to rowLines before it starts a row, and the vblank interrupt puts it back
+	// to rowLines, so starting it at -FRAME_LINES keeps the DMA (already off) from starting a row until the next frame
+	lastChange = vblankCyclesLeft() ? rowLines : -FRAME_LINES;
+	videoMode = mode;
+}
+
+/*
+ * In field mode, how many rows of the screen buffer the current field has finished scanning out, so they can be refilled
+ * with the next field's rows. 0 until the first visible line, since the vblank interrupt starts a new field
+ */
+int fieldSlotsDone() {
+	int line = curLine;
+	if(line >= rowCount)
+		return 0;
+	return (line - (int) (frameCount & 1) + 1) >> 1;
+}
+
+/*
+ * In colour mode, how many rows of the screen buffer the beam has finished with in the current frame, so they can be
+ * changed for the next one. 0 until the first visible line
+ */
+int rowsDone() {
+	int line = curLine;
+	return line >= rowCount ? 0 : line;
+}
+
+/*
+ * how many cycles are left before the first visible line, 0 if the beam is in the visible region
+ */
+uint32_t vblankCyclesLeft() {
+	uint32_t cnt = TIM2->CNT;
+	if(cnt >= VISIBLE_END)
+		return FRAME_LINES * LINE_CYCLES - cnt + VISIBLE_START;
+	if(cnt < VISIBLE_START)
+		return VISIBLE_START - cnt;
+	return 0;
+}
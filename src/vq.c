@@ -0,0 +1,78 @@
+#include "stm32f0xx.h"
+#include "vga.h"
+#include "assets.h"
+#include "vq.h"
+
+static int blocksPerFrame(const vqHeader *vq) {
+	return (WIDTH / vq->blockWidth) * (HEIGHT / vq->blockHeight);
+}
+
+// dictionary words
+static int dictionarySize(const vqHeader *vq) {
+	return vq->codes * vq->blockWidth * vq->blockHeight / 4;
+}
+
+/*
+ * whether an asset is a VQ clip of the screen's size whose length adds up
+ */
+int vqValid(const assetEntry *asset) {
+	if(!asset || asset->format != ASSET_FORMAT_VQ || asset->width != WIDTH || asset->height != HEIGHT)
+		return 0;
+	const vqHeader *vq = (const vqHeader *) assetData(asset);
+	if(asset->length < sizeof(vqHeader) || vq->blockWidth != vq->blockHeight)
+		return 0;
+	if((vq->blockWidth != 2 && vq->blockWidth != 4) || !vq->codes || vq->codes > 256)
+		return 0;
+	return asset->length == sizeof(vqHeader) + 4 * dictionarySize(vq) + asset->frames * blocksPerFrame(vq);
+}
+
+/*
+ * the block indices of one frame of a clip
+ */
+const uint8_t *vqFrame(const assetEntry *asset, int frame) {
+	const vqHeader *vq = (const vqHeader *) assetData(asset);
+	return (const uint8_t *) (vq->dictionary + dictionarySize(vq)) + frame * blocksPerFrame(vq);
+}
+
+/*
+ * Decode rows of a frame into the screen buffer, from row (the start of a row of blocks) up to last, as far as whole
+ * rows of blocks go. Returns the row it got to
+ * Each block is a word read out of the dictionary per row of pixels, stored a byte at a time since the screen rows
+ * (WIDTH + 1 bytes) don't keep the words aligned
+ */
+int vqDecodeRows(const vqHeader *vq, const uint8_t *indices, int row, int last) {
+	int across = WIDTH / vq->blockWidth;
+	indices += row / vq->blockHeight * across;
+	if(vq->blockWidth == 2) {
+		for(; row + 2 <= last; row += 2) {
+			char *top = screen.color[row];
+			char *bottom = screen.color[row + 1];
+			for(int x = 0; x < across; x++) {
+				uint32_t block = vq->dictionary[*indices++];
+				top[0] = block;
+				top[1] = block >> 8;
+				bottom[0] = block >> 16;
+				bottom[1] = block >> 24;
+				top += 2;
+				bottom += 2;
+			}
+		}
+	} else {
+		for(; row + 4 <= last; row += 4) {
+			char *out = screen.color[row];
+			for(int x = 0; x < across; x++) {
+				const uint32_t *block = &vq->dictionary[4 * *indices++];
+				for(int y = 0; y < 4; y++) {
+					uint32_t pixels = block[y];
+					char *p = out + y * (WIDTH + 1);
+					p[0] = pixels;
+					p[1] = pixels >> 8;
+					p[2] = pixels >> 16;
+					p[3] = pixels >> 24;
+				}
+				out += 4;
+			}
+		}
+	}
+	return row;
+}
@@ -0,0 +1,144 @@
+/*
+ * Host tests for the animation player (src/anim.c), with a stand-in asset index: an indexed clip and a scan-out
+ * dither pair played in turn. Each frame the beam's rows go by (animLine) and then the vblank comes (animUpdate),
+ * and what's revealed is checked against the sequence.
+ */
+#include <stdio.h>
+#include "vga.h"
+#include "assets.h"
+#include "anim.h"
+
+screenBuffer screen;
+const char *volatile frame = 0;
+volatile unsigned int frameCount = 100;
+
+static int beamRow = 0;
+static int inVblank = 1;
+
+int rowsDone() {
+	return beamRow;
+}
+
+uint32_t vblankCyclesLeft() {
+	return inVblank ? 1000 : 0;
+}
+
+// an indexed clip of 2 frames and a scan-out dither pair
+#define CLIP 0
+#define SCANOUT 1
+static assetEntry entries[2];
+static char clip[2][HEIGHT * WIDTH];
+static char scanout[2][HEIGHT * (WIDTH + 1)];
+
+const assetEntry *assetFind(uint16_t id) {
+	return id < 2 ? &entries[id] : 0;
+}
+
+const char *assetData(const assetEntry *asset) {
+	return asset == &entries[CLIP] ? clip[0] : scanout[0];
+}
+
+// the index and each format's geometry are checked by test_assets
+int assetCheck(const assetEntry *asset) {
+	return 1;
+}
+
+static int failures = 0;
+
+#define CHECK(cond) do { if(!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while(0)
+
+static void makeAssets() {
+	for(int i = 0; i < 2; i++) {
+		entries[i].id = i;
+		entries[i].height = HEIGHT;
+		entries[i].frames = 2;
+		entries[i].palette = PALETTE;
+	}
+	entries[CLIP].width = WIDTH;
+	entries[CLIP].format = ASSET_FORMAT_INDEXED;
+	entries[CLIP].length = sizeof(clip);
+	entries[SCANOUT].width = WIDTH + 1;
+	entries[SCANOUT].format = ASSET_FORMAT_SCANOUT;
+	entries[SCANOUT].length = sizeof(scanout);
+	for(int i = 0; i < HEIGHT * WIDTH; i++) {
+		clip[0][i] = 'a';
+		clip[1][i] = 'b';
+	}
+	for(int i = 0; i < HEIGHT * (WIDTH + 1); i++)
+		scanout[0][i] = i % (WIDTH + 1) == WIDTH ? 0 : 'S';
+}
+
+/*
+ * One frame: the beam goes down the screen with the main loop waking every few rows, then the vblank.
+ * Returns what the top left pixel of the picture is afterwards, or 0 for nothing
+ */
+static char playFrame() {
+	inVblank = 0;
+	for(beamRow = 0; beamRow <= HEIGHT; beamRow += 6)
+		animLine();
+	frameCount++;
+	inVblank = 1;
+	beamRow = 0;
+	animUpdate();
+	return frame ? frame[0] : 0;
+}
+
+static void testPlayable() {
+	static const animFrame missing[] = {{CLIP, 1}, {7, 1}};
+	static const animFrame still[] = {{CLIP, 0}};
+	CHECK(!animStart(missing, 2, 0));
+	CHECK(!animStart(still, 1, 0));
+	CHECK(!animActive());
+}
+
+static void testSequence() {
+	// the clip's frames for 2 refreshes each, then the scan-out pair for 3
+	static const animFrame sequence[] = {{CLIP, 2}, {SCANOUT, 3}};
+	static const char expected[] = "aabbSSSaabbSSS";
+	frame = screen.color[0];
+	animShown = animLate = animDropped = 0;
+	CHECK(animStart(sequence, 2, 1));
+	for(int i = 0; expected[i]; i++) {
+		char shown = playFrame();
+		if(shown != expected[i])
+			printf("frame %d shows %c, not %c\n", i, shown, expected[i]);
+		CHECK(shown == expected[i]);
+		if(expected[i] == 'S')
+			CHECK(frame == scanout[0]); // straight from flash, no copy
+		else
+			CHECK(frame == screen.color[0] && screen.color[HEIGHT - 1][WIDTH - 1] == expected[i]);
+	}
+	CHECK(animShown == 6);
+	CHECK(animLate == 0);
+	CHECK(animDropped == 0);
+
+	// stopping on the scan-out picture copies it into the screen buffer, so the asset region is free again
+	animStop();
+	CHECK(!animActive());
+	CHECK(frame == screen.color[0]);
+	CHECK(screen.color[HEIGHT - 1][WIDTH - 1] == 'S' && screen.color[HEIGHT - 1][WIDTH] == 0);
+}
+
+static void testLate() {
+	static const animFrame sequence[] = {{CLIP, 2}, {SCANOUT, 2}};
+	frame = screen.color[0];
+	animShown = animLate = animDropped = 0;
+	CHECK(animStart(sequence, 2, 0));
+	playFrame();
+	// the main loop is held up over 4 vblanks, past the clip's second frame and into the scan-out picture's time,
+	// so the clip's frame is skipped and the scan-out picture is shown a frame late
+	frameCount += 4;
+	CHECK(playFrame() == 'S');
+	CHECK(animDropped == 1);
+	CHECK(animLate == 1);
+	animStop();
+}
+
+int main() {
+	makeAssets();
+	testPlayable();
+	testSequence();
+	testLate();
+	printf("test_anim: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * Host tests for the asset index (src/assets.c): entries that would read outside the asset region, or whose size
+ * doesn't match what their format needs, are refused before anything reads their data.
+ * The region is an array here, which the Makefile links in as _sassets and _eassetregion.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "vga.h"
+#include "assets.h"
+
+#define REGION_SIZE (32 * 1024)
+
+uint32_t assetRegion[REGION_SIZE / 4];
+screenBuffer screen; // for the decoders, which aren't run here
+
+static assetIndex *const table = (assetIndex *) assetRegion;
+
+static int failures = 0;
+
+#define CHECK(cond) do { if(!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while(0)
+
+// the first data offset after an index of 4 entries
+#define DATA (sizeof(assetIndex) + 4 * sizeof(assetEntry))
+
+/*
+ * An index of 4 entries, each a still picture in one of the raw formats, one after the other
+ */
+static void makeIndex() {
+	static const uint16_t sizes[4][3] = {
+		{ASSET_FORMAT_INDEXED, WIDTH, HEIGHT},
+		{ASSET_FORMAT_SCANOUT, WIDTH + 1, HEIGHT},
+		{ASSET_FORMAT_MONO, MONO_WIDTH, MONO_HEIGHT},
+		{ASSET_FORMAT_FIELDS, WIDTH, 2 * HEIGHT},
+	};
+	static const uint32_t lengths[4] = {WIDTH * HEIGHT, (WIDTH + 1) * HEIGHT, MONO_STRIDE * MONO_HEIGHT, WIDTH * 2 * HEIGHT};
+	memset(assetRegion, 0, sizeof(assetRegion));
+	table->magic = ASSET_MAGIC;
+	table->count = 4;
+	uint32_t offset = DATA;
+	for(int i = 0; i < 4; i++) {
+		assetEntry *entry = &table->entries[i];
+		entry->id = i;
+		entry->format = sizes[i][0];
+		entry->width = sizes[i][1];
+		entry->height = sizes[i][2];
+		entry->frames = 1;
+		entry->palette = PALETTE;
+		entry->offset = offset;
+		entry->length = lengths[i];
+		offset += (lengths[i] + 3) & ~3;
+	}
+}
+
+static void testValid() {
+	makeIndex();
+	for(int i = 0; i < 4; i++) {
+		CHECK(assetFind(i) == &table->entries[i]);
+		CHECK(assetAt(i) == &table->entries[i]);
+		CHECK(assetValid(assetFind(i)));
+	}
+	CHECK(!assetFind(4));
+	CHECK(!assetAt(4));
+	CHECK(!assetValid(0));
+}
+
+static void testIndex() {
+	makeIndex();
+	table->magic = 0xffffffff; // erased
+	CHECK(!assetFind(0));
+	CHECK(!assetAt(0));
+
+	// more entries than the region could hold
+	makeIndex();
+	table->count = REGION_SIZE / sizeof(assetEntry) + 1;
+	CHECK(!assetFind(0));
+	CHECK(!assetAt(0));
+	table->count = 0xffffffff;
+	CHECK(!assetFind(0));
+}
+
+static void testBounds() {
+	assetEntry *entry = &table->entries[0];
+	makeIndex();
+	entry->offset = REGION_SIZE;
+	CHECK(!assetValid(entry));
+	entry->offset = 0x80000000; // far outside, where reading would fault
+	CHECK(!assetValid(entry));
+	entry->offset = REGION_SIZE - WIDTH * HEIGHT + 4; // runs off the end
+	CHECK(!assetValid(entry));
+	entry->offset = REGION_SIZE - WIDTH * HEIGHT; // just fits
+	CHECK(assetValid(entry));
+	entry->offset = DATA + 2; // not word aligned
+	CHECK(!assetValid(entry));
+	entry->offset = 0; // over the index
+	CHECK(!assetValid(entry));
+
+	makeIndex();
+	entry->length = 0xffffffff;
+	CHECK(!assetValid(entry));
+}
+
+static void testGeometry() {
+	assetEntry *entry = &table->entries[0];
+	makeIndex();
+	entry->width = 40; // a 40x30 picture, which would be shown as garbage
+	entry->height = 30;
+	entry->length = 40 * 30;
+	CHECK(!assetValid(entry));
+
+	makeIndex();
+	entry->frames = 2; // the length only covers one frame
+	CHECK(!assetValid(entry));
+	entry->frames = 0;
+	CHECK(!assetValid(entry));
+
+	makeIndex();
+	entry = &table->entries[1];
+	entry->width = WIDTH; // a scan-out picture has the edge pixel on every row
+	entry->length = WIDTH * HEIGHT;
+	CHECK(!assetValid(entry));
+
+	makeIndex();
+	entry = &table->entries[2];
+	entry->length = MONO_WIDTH * MONO_HEIGHT / 8; // without the blank byte on each row
+	CHECK(!assetValid(entry));
+
+	makeIndex();
+	entry = &table->entries[3];
+	entry->height = HEIGHT; // one field only
+	CHECK(!assetValid(entry));
+
+	makeIndex();
+	entry->format = 9;
+	CHECK(!assetValid(entry));
+}
+
+int main() {
+	testValid();
+	testIndex();
+	testBounds();
+	testGeometry();
+	printf("test_assets: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
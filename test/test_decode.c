@@ -0,0 +1,95 @@
+/*
+ * Host tests for the asset decoders (src/vq.c and src/packed.c): small hand-made clips decoded into the screen buffer,
+ * checked pixel by pixel, including decoding a frame in two goes as the players do behind the beam.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "vga.h"
+#include "vq.h"
+#include "packed.h"
+
+screenBuffer screen;
+
+// the decoders only reach the asset index through vqValid and packedValid, which aren't tested here
+const char *assetData(const assetEntry *asset) {
+	return 0;
+}
+
+static int failures = 0;
+
+#define CHECK(cond) do { if(!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while(0)
+
+static uint32_t clip[1 + 256 * 4 + WIDTH * HEIGHT / 4];
+
+/*
+ * A VQ frame whose block at (bx, by) is entry (bx + by) % codes, and entry i has pixel (x, y) of the block set to
+ * i * 16 + y * block + x, so every pixel of the decoded screen says where it came from
+ */
+static const uint8_t *makeVq(int block, int codes) {
+	vqHeader *vq = (vqHeader *) clip;
+	vq->blockWidth = block;
+	vq->blockHeight = block;
+	vq->codes = codes;
+	uint8_t *entries = (uint8_t *) vq->dictionary;
+	for(int i = 0; i < codes; i++)
+		for(int p = 0; p < block * block; p++)
+			entries[i * block * block + p] = i * 16 + p;
+	uint8_t *indices = entries + codes * block * block;
+	for(int by = 0; by < HEIGHT / block; by++)
+		for(int bx = 0; bx < WIDTH / block; bx++)
+			indices[by * (WIDTH / block) + bx] = (bx + by) % codes;
+	return indices;
+}
+
+static void checkVq(int block, int codes, int split) {
+	const uint8_t *indices = makeVq(block, codes);
+	memset(&screen, 0xAA, sizeof(screen));
+	int row = vqDecodeRows((const vqHeader *) clip, indices, 0, split);
+	CHECK(row == split / block * block);
+	row = vqDecodeRows((const vqHeader *) clip, indices, row, HEIGHT);
+	CHECK(row == HEIGHT);
+	int wrong = 0;
+	for(int y = 0; y < HEIGHT; y++) {
+		for(int x = 0; x < WIDTH; x++) {
+			int entry = (x / block + y / block) % codes;
+			wrong += (uint8_t) screen.color[y][x] != (uint8_t) (entry * 16 + (y % block) * block + x % block);
+		}
+		// the edge pixel is left alone
+		wrong += (uint8_t) screen.color[y][WIDTH] != 0xAA;
+	}
+	CHECK(wrong == 0);
+}
+
+static void checkPacked(int bits, int split) {
+	packedHeader *packed = (packedHeader *) clip;
+	packed->bits = bits;
+	for(int i = 0; i < 16; i++)
+		packed->palette[i] = 0x40 + i;
+	// pixel (x, y) is index (x + y) % colours, the first of each byte in its high bits
+	uint8_t *pixels = (uint8_t *) (packed + 1);
+	int colours = 1 << bits, perByte = 8 / bits;
+	memset(pixels, 0, WIDTH * HEIGHT * bits / 8);
+	for(int y = 0; y < HEIGHT; y++)
+		for(int x = 0; x < WIDTH; x++)
+			pixels[(y * WIDTH + x) / perByte] |= ((x + y) % colours) << (8 - bits * (x % perByte + 1));
+	memset(&screen, 0xAA, sizeof(screen));
+	CHECK(packedDecodeRows(packed, pixels, 0, split) == split);
+	CHECK(packedDecodeRows(packed, pixels, split, HEIGHT) == HEIGHT);
+	int wrong = 0;
+	for(int y = 0; y < HEIGHT; y++) {
+		for(int x = 0; x < WIDTH; x++)
+			wrong += (uint8_t) screen.color[y][x] != 0x40 + (x + y) % colours;
+		wrong += (uint8_t) screen.color[y][WIDTH] != 0xAA;
+	}
+	CHECK(wrong == 0);
+}
+
+int main() {
+	checkVq(2, 7, 13);
+	checkVq(4, 5, 13);
+	checkVq(4, 256, 0);
+	checkPacked(2, 7);
+	checkPacked(4, 31);
+	printf("test_decode: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
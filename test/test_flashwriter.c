@@ -0,0 +1,132 @@
+/*
+ * Host tests for the flash writer's packets (src/flashwriter.c): an upload done the way imgconverter/upload.py does it
+ * lands in the asset region, and erases and writes past the end of the region are refused.
+ * The region is an array here, which the Makefile links in as _sassets and _eassetregion. FLASH is pointed at an
+ * ordinary struct, so erasing doesn't clear anything and programming is a plain store.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "stm32f0xx.h"
+
+static FLASH_TypeDef hostFLASH;
+#undef FLASH
+#define FLASH (&hostFLASH)
+
+#include "../src/flashwriter.c"
+
+#define REGION_SIZE (32 * 1024)
+
+char assetRegion[REGION_SIZE];
+uint32_t g_pfnVectors[VECTORS];
+volatile unsigned int frameCount = 0;
+
+static uint8_t input[128];
+static int inputLen, inputPos;
+static char replies[8];
+static int replyCount;
+
+int uartRead() {
+	return inputPos < inputLen ? input[inputPos++] : -1;
+}
+
+void uartWrite(char c) {
+	if(replyCount < (int) sizeof(replies))
+		replies[replyCount++] = c;
+}
+
+void uartPrintNum(uint32_t n) {
+}
+
+int drawQueue(uint8_t cmd, const uint8_t *payload, uint8_t len) {
+	return -1; // not a drawing command
+}
+
+void shellInput(char c) {
+}
+
+// time for one half-word each vblank, so that send can clear the status flags between them
+uint32_t vblankCyclesLeft() {
+	static int odd = 0;
+	odd ^= 1;
+	return odd ? PROGRAM_CYCLES + 1 : 0;
+}
+
+static int failures = 0;
+
+#define CHECK(cond) do { if(!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while(0)
+
+/*
+ * Send a packet and run the vblank work until it's answered, returning the answer
+ */
+static char send(uint8_t cmd, const uint8_t *payload, int len) {
+	uint8_t sum = cmd ^ len;
+	input[0] = SYNC;
+	input[1] = cmd;
+	input[2] = len;
+	for(int i = 0; i < len; i++) {
+		input[3 + i] = payload[i];
+		sum ^= payload[i];
+	}
+	input[3 + len] = sum;
+	inputLen = len + 4;
+	inputPos = 0;
+	replyCount = 0;
+	flashWriterPoll();
+	for(int i = 0; i < 1000 && !replyCount; i++) {
+		hostFLASH.SR = 0; // the flags are write 1 to clear on the chip, so whatever the last operation wrote is gone
+		flashWriterRun();
+	}
+	return replyCount == 1 ? replies[0] : '?';
+}
+
+static char erase(int page) {
+	uint8_t payload[1] = {page};
+	return send('E', payload, 1);
+}
+
+static char write(int offset, const uint8_t *data, int len) {
+	uint8_t payload[2 + MAX_DATA];
+	payload[0] = offset;
+	payload[1] = offset >> 8;
+	memcpy(payload + 2, data, len);
+	return send('W', payload, 2 + len);
+}
+
+/*
+ * Upload a blob as upload.py does: pad it to an even length, erase every page it touches, then write it 64 bytes at a time
+ */
+static void upload(const uint8_t *blob, int len) {
+	int padded = len + (len & 1);
+	int bad = 0;
+	for(int page = 0; page * PAGE_SIZE < padded; page++)
+		bad += erase(page) != 'K';
+	for(int offset = 0; offset < padded; offset += MAX_DATA) {
+		int chunk = padded - offset < MAX_DATA ? padded - offset : MAX_DATA;
+		bad += write(offset, blob + offset, chunk) != 'K';
+	}
+	CHECK(bad == 0);
+	CHECK(send('D', 0, 0) == 'K');
+	CHECK(memcmp(assetRegion, blob, len) == 0);
+}
+
+int main() {
+	static uint8_t blob[REGION_SIZE];
+	for(int i = 0; i < REGION_SIZE; i++)
+		blob[i] = i * 7 + (i >> 8);
+
+	// the size of the assets built into the firmware, then bigger than them, then odd, then the whole region
+	upload(blob, 29348);
+	upload(blob, 30001);
+	upload(blob, REGION_SIZE);
+
+	CHECK(erase(REGION_SIZE / PAGE_SIZE - 1) == 'K');
+	CHECK(erase(REGION_SIZE / PAGE_SIZE) == 'N');
+	CHECK(write(REGION_SIZE - 2, blob, 2) == 'K');
+	CHECK(write(REGION_SIZE - 2, blob, 4) == 'N');
+	CHECK(write(REGION_SIZE - 64, blob, 64) == 'K');
+	CHECK(write(1, blob, 2) == 'N'); // half-words only
+	CHECK(send('D', 0, 0) == 'K');
+
+	printf("test_flashwriter: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}
@@ -0,0 +1,162 @@
+/*
+ * Host tests for the video core (src/vga.c), run against the stand-in registers in src/regs_host.c.
+ * A frame is played by setting TIM2 to each line in turn and calling the line interrupt, then the vblank one,
+ * and the DMA addresses it loaded are checked against the rows of the picture.
+ */
+#include <stdio.h>
+#include "regs.h"
+#include "vga.h"
+
+void TIM3_IRQHandler(void);
+void TIM2_IRQHandler(void);
+
+static int failures = 0;
+
+#define CHECK(cond) do { if(!(cond)) { printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while(0)
+
+static uint32_t address(const volatile void *p) {
+	return (uint32_t) (uintptr_t) p;
+}
+
+/*
+ * Run the line interrupts for lines first up to last.
+ * Fills loads with the addresses the DMA was started from, in order, and returns how many there were
+ */
+static int scanLines(int first, int last, uint32_t *loads, int max) {
+	int count = 0;
+	for(int line = first; line < last; line++) {
+		hostTIM2.CNT = line * LINE_CYCLES + LINE_ISR_AT;
+		hostTIM3.CNT = LINE_ISR_AT;
+		regLogCount = 0;
+		TIM3_IRQHandler();
+		for(int i = 0; i < regLogCount; i++)
+			if(regLog[i].reg == &hostDMA1_Channel5.CMAR && count < max)
+				loads[count++] = regLog[i].value;
+	}
+	return count;
+}
+
+/*
+ * Run one frame of line interrupts and the vblank interrupt after it
+ */
+static int scanFrame(uint32_t *loads, int max) {
+	int count = scanLines(0, FRAME_LINES - 1, loads, max);
+	hostTIM2.SR = TIM_SR_CC3IF;
+	TIM2_IRQHandler();
+	return count;
+}
+
+static void testSetup() {
+	regReset();
+	frame = 0;
+	setupHorizontalTimers();
+	setupVerticalTimer();
+	CHECK(hostTIM3.ARR == LINE_CYCLES - 1);
+	CHECK(hostTIM3.CCR1 == PIXEL_START);
+	CHECK(hostTIM3.CCR3 == LINE_ISR_AT);
+	CHECK(hostTIM2.ARR == FRAME_LINES * LINE_CYCLES - 1);
+	CHECK(hostTIM15.RCR == WIDTH);
+	CHECK(hostDMA1_Channel5.CNDTR == WIDTH + 1);
+	CHECK(hostDMA1_Channel5.CPAR == address(&hostGPIOB.ODR));
+	// the line interrupt has to be able to preempt the vblank one
+	CHECK(irqEnabled & (1 << TIM3_IRQn));
+	CHECK(irqEnabled & (1 << TIM2_IRQn));
+	CHECK(irqPriority[TIM3_IRQn] < irqPriority[TIM2_IRQn]);
+}
+
+static void testBlank() {
+	uint32_t loads[MONO_HEIGHT];
+	regReset();
+	setVideoMode(VIDEO_COLOR);
+	frame = 0;
+	CHECK(scanFrame(loads, MONO_HEIGHT) == 0);
+	CHECK(!(hostDMA1_Channel5.CCR & DMA_CCR_EN));
+}
+
+static void testColorLines() {
+	uint32_t loads[MONO_HEIGHT];
+	regReset();
+	setVideoMode(VIDEO_COLOR);
+	frame = screen.color[0];
+	// the first frame after the mode is set can start part way through, so look at the second
+	scanFrame(loads, MONO_HEIGHT);
+	int count = scanFrame(loads, MONO_HEIGHT);
+	CHECK(count == HEIGHT);
+	for(int row = 0; row < count; row++)
+		CHECK(loads[row] == address(screen.color[row]));
+	CHECK(lendflag);
+}
+
+static void testMonoLines() {
+	uint32_t loads[MONO_HEIGHT];
+	regReset();
+	hostGPIOB.ODR = 1 << 12;
+	setVideoMode(VIDEO_MONO);
+	CHECK(videoMode == VIDEO_MONO);
+	CHECK(hostDMA1_Channel5.CPAR == address(&hostSPI1.DR));
+	CHECK(hostDMA1_Channel5.CNDTR == MONO_STRIDE);
+	CHECK(hostTIM15.ARR == 15);
+	CHECK(hostTIM15.RCR == MONO_STRIDE - 1);
+	CHECK(hostSPI1.CR1 & SPI_CR1_SPE);
+	CHECK(((hostGPIOB.MODER >> (2 * 5)) & 0x3) == 0x2);
+	CHECK(hostGPIOB.ODR == 1 << 12); // the colour pins go black, the SPI flash's CS stays high
+	frame = (const char *) screen.mono[0];
+	scanFrame(loads, MONO_HEIGHT);
+	int count = scanFrame(loads, MONO_HEIGHT);
+	CHECK(count == MONO_HEIGHT);
+	for(int row = 0; row < count; row++)
+		CHECK(loads[row] == address(screen.mono[row]));
+
+	setVideoMode(VIDEO_COLOR);
+	CHECK(!(hostSPI1.CR1 & SPI_CR1_SPE));
+	CHECK(hostDMA1_Channel5.CPAR == address(&hostGPIOB.ODR));
+	CHECK(((hostGPIOB.MODER >> (2 * 5)) & 0x3) == 0x1);
+}
+
+static void testFieldLines() {
+	uint32_t loads[MONO_HEIGHT];
+	regReset();
+	setVideoMode(VIDEO_FIELDS);
+	frame = screen.color[0];
+	scanFrame(loads, MONO_HEIGHT);
+	// both fields show every row of the buffer once, each for half the picture's lines
+	for(int field = 0; field < 2; field++) {
+		int count = scanFrame(loads, MONO_HEIGHT);
+		CHECK(count == HEIGHT);
+		for(int row = 0; row < count; row++)
+			CHECK(loads[row] == address(screen.color[row]));
+	}
+}
+
+static void testSwitchMidFrame() {
+	uint32_t loads[MONO_HEIGHT];
+	regReset();
+	setVideoMode(VIDEO_COLOR);
+	frame = screen.color[0];
+	scanFrame(loads, MONO_HEIGHT);
+	// halfway down the picture, the rest of the frame is blank rather than showing mono rows from the top
+	int half = (VISIBLE_START + VISIBLE_END) / 2 / LINE_CYCLES;
+	int shown = scanLines(0, half, loads, MONO_HEIGHT);
+	CHECK(shown > 0 && shown < HEIGHT);
+	hostTIM2.CNT = half * LINE_CYCLES;
+	setVideoMode(VIDEO_MONO);
+	frame = (const char *) screen.mono[0];
+	CHECK(scanLines(half, FRAME_LINES - 1, loads, MONO_HEIGHT) == 0);
+	hostTIM2.SR = TIM_SR_CC3IF;
+	TIM2_IRQHandler();
+	// from the vblank, the next frame is all mono
+	int count = scanFrame(loads, MONO_HEIGHT);
+	CHECK(count == MONO_HEIGHT);
+	CHECK(loads[0] == address(screen.mono[0]));
+}
+
+int main() {
+	testSetup();
+	testBlank();
+	testColorLines();
+	testMonoLines();
+	testFieldLines();
+	testSwitchMidFrame();
+	printf("test_vga: %s\n", failures ? "FAILED" : "ok");
+	return failures != 0;
+}